@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_column.hpp"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Weather, sunny, cloudy, rainy, windy, snowy, foggy, stormy );
+
+constexpr size_t count = 10000000;
+
+static double nanoseconds_since( std::chrono::steady_clock::time_point start ){
+  std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now( ) - start;
+  return time.count( ) / count;
+}
+
+// Nanoseconds per value to write and to read back a column of enumerators,
+// as CSV text with one name per line and as a binary column
+int main( ){
+  auto values = std::vector<Weather> { };
+  auto seed = std::uint32_t { 1 };
+  for ( size_t i = 0; i < count; ++i ) {
+    seed = seed * 1664525u + 1013904223u;
+    values.push_back( static_cast<Weather>( ( seed >> 16 ) % named_enum::size<Weather>() ) );
+  } // end of i-loop
+  auto checksum = size_t { };
+
+  auto start = std::chrono::steady_clock::now( );
+  auto csv_stream = std::ostringstream { };
+  for ( auto value : values ) {
+    csv_stream << named_enum::name( value ) << '\n';
+  }
+  auto csv = csv_stream.str( );
+  auto csv_write = nanoseconds_since( start );
+
+  start = std::chrono::steady_clock::now( );
+  for ( size_t begin = 0, end; begin < csv.size( ); begin = end + 1 ) {
+    end = csv.find( '\n', begin );
+    checksum += static_cast<size_t>( named_enum::from_string<Weather>( csv.data( ) + begin, end - begin ) );
+  }
+  auto csv_read = nanoseconds_since( start );
+
+  start = std::chrono::steady_clock::now( );
+  auto column_stream = std::ostringstream { };
+  {
+    named_enum::column_writer<Weather> writer( column_stream );
+    writer.append( values.data( ), values.size( ) );
+  }
+  auto column = column_stream.str( );
+  auto column_write = nanoseconds_since( start );
+
+  start = std::chrono::steady_clock::now( );
+  auto view = named_enum::column_view<Weather>( column.data( ), column.size( ) );
+  for ( std::uint64_t i = 0; i < view.size( ); ++i ) {
+    checksum -= static_cast<size_t>( view[i] );
+  } // end of i-loop
+  auto column_read = nanoseconds_since( start );
+
+  std::cout << "format   bytes   write ns   read ns" << std::endl;
+  std::cout << "csv   " << csv.size( ) << "   " << csv_write << "   " << csv_read << std::endl;
+  std::cout << "column   " << column.size( ) << "   " << column_write << "   " << column_read << std::endl;
+  if ( checksum != 0 ) std::cerr << "values differ" << std::endl;
+}
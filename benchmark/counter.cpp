@@ -0,0 +1,72 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_counter.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Request, get, put, post, remove, head, options );
+
+static named_enum::enum_counter<Request, 64> sharded;
+static named_enum::enum_counter<Request, 1> shared; // all threads on one shard
+
+constexpr std::uint64_t increments = 10000000; // per thread
+
+// Million increments per second of all threads together
+template<typename Counter>
+double throughput( Counter & counter,
+                   size_t threads ){
+  counter.reset( );
+  auto start = std::chrono::steady_clock::now( );
+  auto workers = std::vector<std::thread> { };
+  for ( size_t t = 0; t < threads; ++t ) {
+    workers.emplace_back( [&counter](){
+      for ( std::uint64_t i = 0; i < increments; ++i ) {
+        counter.increment( static_cast<Request>( i % named_enum::size<Request>() ) );
+      } // end of i-loop
+    } );
+  } // end of t-loop
+  for ( auto & worker : workers ) {
+    worker.join( );
+  }
+  std::chrono::duration<double> seconds = std::chrono::steady_clock::now( ) - start;
+  return threads * increments / seconds.count( ) / 1e6;
+}
+
+// Increments per second of enum_counter with one shard per thread and with a
+// single shared shard, for 1 to N threads, where N is given as argument or
+// defaults to the number of hardware threads
+int main( int argc,
+          char **argv ){
+  auto max_threads = argc > 1 ? static_cast<size_t>( std::atoi( argv[1] ) ) :
+                     static_cast<size_t>( std::thread::hardware_concurrency( ) );
+  if ( max_threads == 0 ) max_threads = 1;
+
+  std::cout << "threads   sharded M/s   shared M/s" << std::endl;
+  for ( size_t threads = 1; threads <= max_threads; ++threads ) {
+    auto a = throughput( sharded, threads );
+    auto b = throughput( shared, threads );
+    std::cout << threads << "   " << a << "   " << b << std::endl;
+  } // end of threads-loop
+}
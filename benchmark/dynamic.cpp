@@ -0,0 +1,99 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_dynamic.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+constexpr size_t known = 1000;     // names registered before reading
+constexpr size_t added = 20000;    // names registered one by one while reading
+constexpr size_t lookups = 2000000; // per reader
+
+// Nanoseconds per from_string and name lookup of known names, averaged over
+// the readers, while a writer registers added names one by one if writing.
+// This is wall time, so threads taking turns on a core count each other's work.
+std::pair<double, size_t> read( size_t readers,
+                                bool writing ){
+  named_enum::dynamic_enum registry;
+  auto strings = std::vector<std::string> { };
+  for ( size_t i = 0; i < known + added; ++i ) {
+    strings.push_back( "category_" + std::to_string( i ) );
+  } // end of i-loop
+  for ( size_t i = 0; i < known; ++i ) {
+    registry.add( strings[i].c_str( ) );
+  } // end of i-loop
+
+  std::atomic<bool> done { false };
+  std::thread writer( [&](){
+    for ( auto i = known; writing && i < known + added && !done; ++i ) {
+      registry.add( strings[i].c_str( ) );
+    } // end of i-loop
+  } );
+
+  auto times = std::vector<double>( readers );
+  auto threads = std::vector<std::thread> { };
+  for ( size_t r = 0; r < readers; ++r ) {
+    threads.emplace_back( [&, r](){
+      auto sum = size_t { };
+      auto start = std::chrono::steady_clock::now( );
+      for ( size_t i = 0; i < lookups; ++i ) {
+        auto value = registry.from_string( strings[( i * 7919 + r ) % known].c_str( ) );
+        sum += registry.name( value )[9];
+      } // end of i-loop
+      std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now( ) - start;
+      times[r] = elapsed.count( ) / lookups;
+      if ( sum == 0 ) std::cerr << "nothing read" << std::endl;
+    } );
+  } // end of r-loop
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+  done = true;
+  writer.join( );
+  auto total = 0.0;
+  for ( auto t : times ) {
+    total += t;
+  }
+  return { total / readers, registry.size( ) - known };
+}
+
+// Lookup cost of dynamic_enum for 1 to N readers, alone and while a writer
+// registers names, where N is given as argument or defaults to the number
+// of hardware threads
+int main( int argc,
+          char **argv ){
+  auto max_readers = argc > 1 ? static_cast<size_t>( std::atoi( argv[1] ) ) :
+                     static_cast<size_t>( std::thread::hardware_concurrency( ) );
+  if ( max_readers == 0 ) max_readers = 1;
+
+  std::cout << "readers   alone ns   writing ns   names registered meanwhile" << std::endl;
+  for ( size_t readers = 1; readers <= max_readers; ++readers ) {
+    auto alone = read( readers, false );
+    auto writing = read( readers, true );
+    std::cout << readers << "   " << alone.first << "   " << writing.first << "   " << writing.second << std::endl;
+  } // end of readers-loop
+}
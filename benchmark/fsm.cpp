@@ -0,0 +1,148 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_fsm.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Connection, closed, listening, syn_received, established, closing, time_wait );
+MAKE_NAMED_ENUM_CLASS( Segment, open, syn, ack, fin, reset, timeout );
+
+struct counters {
+  std::uint64_t opened, acknowledged, finished, resets, ignored;
+};
+
+static void open( counters & c ){ ++c.opened; }
+static void acknowledge( counters & c ){ ++c.acknowledged; }
+static void finish( counters & c ){ ++c.finished; }
+static void reset( counters & c ){ ++c.resets; }
+static void ignore( counters & c ){ ++c.ignored; }
+
+using C=Connection;
+using S=Segment;
+
+constexpr named_enum::fsm_table<Connection, Segment, counters> table { {
+  { C::closed, S::open, C::listening, &open },
+  { C::listening, S::syn, C::syn_received, &acknowledge },
+  { C::listening, S::timeout, C::closed, &reset },
+  { C::syn_received, S::ack, C::established, &acknowledge },
+  { C::syn_received, S::reset, C::listening, &reset },
+  { C::syn_received, S::timeout, C::closed, &reset },
+  { C::established, S::ack, C::established, &acknowledge },
+  { C::established, S::fin, C::closing, &finish },
+  { C::established, S::reset, C::closed, &reset },
+  { C::closing, S::ack, C::time_wait, &acknowledge },
+  { C::closing, S::reset, C::closed, &reset },
+  { C::time_wait, S::timeout, C::closed, &finish },
+}, &ignore };
+
+// The same machine written as nested switches
+static void step( Connection & state,
+                  Segment event,
+                  counters & c ){
+  switch ( state ) {
+    case C::closed:
+      if ( event == S::open ) { state = C::listening; open( c ); return; }
+      break;
+    case C::listening:
+      switch ( event ) {
+        case S::syn: state = C::syn_received; acknowledge( c ); return;
+        case S::timeout: state = C::closed; reset( c ); return;
+        default: break;
+      }
+      break;
+    case C::syn_received:
+      switch ( event ) {
+        case S::ack: state = C::established; acknowledge( c ); return;
+        case S::reset: state = C::listening; reset( c ); return;
+        case S::timeout: state = C::closed; reset( c ); return;
+        default: break;
+      }
+      break;
+    case C::established:
+      switch ( event ) {
+        case S::ack: acknowledge( c ); return;
+        case S::fin: state = C::closing; finish( c ); return;
+        case S::reset: state = C::closed; reset( c ); return;
+        default: break;
+      }
+      break;
+    case C::closing:
+      switch ( event ) {
+        case S::ack: state = C::time_wait; acknowledge( c ); return;
+        case S::reset: state = C::closed; reset( c ); return;
+        default: break;
+      }
+      break;
+    case C::time_wait:
+      if ( event == S::timeout ) { state = C::closed; finish( c ); return; }
+      break;
+  }
+  ignore( c );
+}
+
+// Nanoseconds per step over the events
+template<typename F>
+double per_step( std::vector<Segment> const & events,
+                 F && f ){
+  auto state = C::closed;
+  auto c = counters { };
+  auto start = std::chrono::steady_clock::now( );
+  for ( auto event : events ) {
+    f( state, event, c );
+  }
+  std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now( ) - start;
+  if ( c.opened + c.acknowledged + c.finished + c.resets + c.ignored != events.size( ) ) {
+    std::cerr << "lost steps" << std::endl;
+  }
+  return time.count( ) / events.size( );
+}
+
+// Nanoseconds per step of fsm_table and of nested switches, for random events
+// and for a repeating handshake that branch predictors learn
+int main( ){
+  auto random = std::vector<Segment> { };
+  auto seed = std::uint32_t { 1 };
+  for ( size_t i = 0; i < 10000000; ++i ) {
+    seed = seed * 1664525u + 1013904223u;
+    random.push_back( static_cast<Segment>( ( seed >> 16 ) % named_enum::size<Segment>() ) );
+  } // end of i-loop
+
+  Segment const handshake[] = { S::open, S::syn, S::ack, S::ack, S::fin, S::ack, S::timeout };
+  auto repeating = std::vector<Segment> { };
+  for ( size_t i = 0; i < random.size( ); ++i ) {
+    repeating.push_back( handshake[i % 7] );
+  } // end of i-loop
+
+  auto table_step = []( Connection & state, Segment event, counters & c ){
+    table.step( state, event, c );
+  };
+  auto switch_step = []( Connection & state, Segment event, counters & c ){
+    step( state, event, c );
+  };
+
+  std::cout << "events   fsm_table ns   switch ns" << std::endl;
+  std::cout << "random   " << per_step( random, table_step ) << "   " << per_step( random, switch_step ) << std::endl;
+  std::cout << "repeating   " << per_step( repeating, table_step ) << "   " << per_step( repeating, switch_step )
+            << std::endl;
+}
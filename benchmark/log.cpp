@@ -0,0 +1,87 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_log.hpp"
+#include "../example/order.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+constexpr size_t batch = 512; // records pushed between two drains
+constexpr size_t batches = 20000;
+
+static named_enum::log_ring<1024> ring;
+
+// Nanoseconds per record spent in f, which handles one batch
+template<typename F>
+double per_record( F && f ){
+  auto time = std::chrono::duration<double, std::nano>( 0 );
+  for ( size_t b = 0; b < batches; ++b ) {
+    auto start = std::chrono::steady_clock::now( );
+    f( b * batch );
+    time += std::chrono::steady_clock::now( ) - start;
+    ring.drain( []( named_enum::log_record const & ){ } );
+  } // end of b-loop
+  return time.count( ) / ( batches * batch );
+}
+
+// Nanoseconds per record on the logging thread for log_enum and for
+// formatting the same record as text, and per record to decode it
+int main( ){
+  auto sink = size_t { };
+
+  auto push = per_record( []( size_t first ){
+    for ( auto i = first; i < first + batch; ++i ) {
+      named_enum::log_enum( ring, static_cast<Order>( i % named_enum::size<Order>() ), i );
+    } // end of i-loop
+  } );
+
+  char buffer[64];
+  auto print = per_record( [&]( size_t first ){
+    for ( auto i = first; i < first + batch; ++i ) {
+      auto order = static_cast<Order>( i % named_enum::size<Order>() );
+      sink += static_cast<size_t>( std::snprintf( buffer, sizeof( buffer ), "%zu : %s\n", i,
+                                                  named_enum::name( order ) ) );
+    } // end of i-loop
+  } );
+
+  auto stream = per_record( [&]( size_t first ){
+    std::ostringstream text;
+    for ( auto i = first; i < first + batch; ++i ) {
+      text << i << " : " << named_enum::name( static_cast<Order>( i % named_enum::size<Order>() ) ) << '\n';
+    } // end of i-loop
+    sink += text.str( ).size( );
+  } );
+
+  auto decoder = named_enum::log_decoder { };
+  decoder.add<Order>( );
+  auto decode = per_record( [&]( size_t first ){
+    for ( auto i = first; i < first + batch; ++i ) {
+      auto record = named_enum::make_record( static_cast<Order>( i % named_enum::size<Order>() ), i );
+      sink += decoder.name( record )[0];
+    } // end of i-loop
+  } );
+
+  std::cout << "log_enum ns   snprintf ns   ostringstream ns   decode ns" << std::endl;
+  std::cout << push << "   " << print << "   " << stream << "   " << decode << std::endl;
+  if ( sink == 0 ) std::cerr << "nothing formatted" << std::endl;
+}
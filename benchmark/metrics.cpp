@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_metrics.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Gauge, STATE_0, STATE_1, STATE_2, STATE_3, STATE_4, STATE_5, STATE_6, STATE_7, STATE_8, STATE_9, STATE_10, STATE_11, STATE_12, STATE_13, STATE_14, STATE_15, STATE_16, STATE_17, STATE_18, STATE_19, STATE_20, STATE_21, STATE_22, STATE_23, STATE_24, STATE_25, STATE_26, STATE_27, STATE_28, STATE_29, STATE_30, STATE_31, STATE_32, STATE_33, STATE_34, STATE_35, STATE_36, STATE_37, STATE_38, STATE_39, STATE_40, STATE_41, STATE_42, STATE_43, STATE_44, STATE_45, STATE_46, STATE_47, STATE_48, STATE_49, STATE_50, STATE_51, STATE_52, STATE_53, STATE_54, STATE_55, STATE_56, STATE_57, STATE_58, STATE_59, STATE_60, STATE_61, STATE_62, STATE_63, STATE_64, STATE_65, STATE_66, STATE_67, STATE_68, STATE_69, STATE_70, STATE_71, STATE_72, STATE_73, STATE_74, STATE_75, STATE_76, STATE_77, STATE_78, STATE_79, STATE_80, STATE_81, STATE_82, STATE_83, STATE_84, STATE_85, STATE_86, STATE_87, STATE_88, STATE_89, STATE_90, STATE_91, STATE_92, STATE_93, STATE_94, STATE_95, STATE_96, STATE_97, STATE_98, STATE_99 );
+
+constexpr size_t families = 100; // of size<Gauge>() series each
+constexpr size_t scrapes = 1000;
+
+// Microseconds per scrape of all families into one buffer
+template<typename F>
+double per_scrape( F && f ){
+  auto start = std::chrono::steady_clock::now( );
+  for ( size_t s = 0; s < scrapes; ++s ) {
+    f( );
+  } // end of s-loop
+  std::chrono::duration<double, std::micro> time = std::chrono::steady_clock::now( ) - start;
+  return time.count( ) / scrapes;
+}
+
+// Time to scrape 100 families of 100 series, with write_metric_family and
+// with snprintf per line
+int main( ){
+  auto names = std::vector<std::string> { };
+  auto counts = std::vector<std::uint64_t> { };
+  for ( size_t f = 0; f < families; ++f ) {
+    names.push_back( "family_" + std::to_string( f ) + "_total" );
+    for ( size_t i = 0; i < named_enum::size<Gauge>(); ++i ) {
+      counts.push_back( f * 1000003 + i * 7919 );
+    } // end of i-loop
+  } // end of f-loop
+
+  auto capacity = size_t { };
+  for ( auto const & name : names ) {
+    capacity += named_enum::metric_family_capacity<Gauge>( name.c_str( ), "state" );
+  }
+  auto buffer = std::vector<char>( capacity );
+  auto bytes = size_t { };
+
+  auto writer = per_scrape( [&](){
+    auto offset = size_t { };
+    for ( size_t f = 0; f < families; ++f ) {
+      offset += named_enum::write_metric_family<Gauge>( buffer.data( ) + offset, buffer.size( ) - offset,
+                                                        names[f].c_str( ), "state",
+                                                        counts.data( ) + f * named_enum::size<Gauge>() );
+    } // end of f-loop
+    bytes = offset;
+  } );
+
+  auto print = per_scrape( [&](){
+    auto offset = size_t { };
+    for ( size_t f = 0; f < families; ++f ) {
+      for ( size_t i = 0; i < named_enum::size<Gauge>(); ++i ) {
+        offset += static_cast<size_t>( std::snprintf( buffer.data( ) + offset, buffer.size( ) - offset,
+                                                      "%s{state=\"%s\"} %llu\n", names[f].c_str( ),
+                                                      named_enum::names<Gauge>()[i],
+                                                      static_cast<unsigned long long>(
+                                                        counts[f * named_enum::size<Gauge>() + i] ) ) );
+      } // end of i-loop
+    } // end of f-loop
+    if ( offset != bytes ) std::cerr << "outputs differ" << std::endl;
+  } );
+
+  std::cout << "series   bytes   write_metric_family us   snprintf us" << std::endl;
+  std::cout << families * named_enum::size<Gauge>() << "   " << bytes << "   " << writer << "   " << print
+            << std::endl;
+}
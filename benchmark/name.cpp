@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Weather, sunny, cloudy, rainy, windy, snowy, foggy, stormy );
+
+constexpr size_t count = 10000000;
+
+// Nanoseconds per value to name a column of valid values read as raw bytes,
+// with name() as compiled by default, with checked_name(), which name()
+// calls when NAMED_ENUM_HARDENED_NAME is defined, and with name_or()
+int main( ){
+  auto values = std::vector<Weather> { };
+  auto seed = std::uint32_t { 1 };
+  for ( size_t i = 0; i < count; ++i ) {
+    seed = seed * 1664525u + 1013904223u;
+    values.push_back( static_cast<Weather>( ( seed >> 16 ) % named_enum::size<Weather>() ) );
+  } // end of i-loop
+
+  auto measure = [&]( auto lookup ){
+    auto start = std::chrono::steady_clock::now( );
+    auto checksum = size_t { };
+    for ( auto value : values ) {
+      checksum += static_cast<unsigned char>( lookup( value )[1] );
+    }
+    std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now( ) - start;
+    if ( checksum == 0 ) std::cerr << "empty names" << std::endl;
+    return time.count( ) / count;
+  };
+
+  auto unchecked = measure( []( Weather value ){
+    return named_enum::name( value );
+  } );
+  auto checked = measure( []( Weather value ){
+    return named_enum::checked_name( value );
+  } );
+  auto fallback = measure( []( Weather value ){
+    return named_enum::name_or( value, "none" );
+  } );
+
+  std::cout << "name ns   checked_name ns   name_or ns" << std::endl;
+  std::cout << unchecked << "   " << checked << "   " << fallback << std::endl;
+}
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_open.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Codec, h264, h265, vp8, vp9, av1 );
+
+using open_codec=named_enum::open_enum<Codec, 1024>;
+
+constexpr size_t parses = 2000000; // per thread
+
+// Million parses per second of all threads together
+template<typename F>
+double throughput( size_t threads,
+                   F const & parse ){
+  auto start = std::chrono::steady_clock::now( );
+  auto workers = std::vector<std::thread> { };
+  for ( size_t t = 0; t < threads; ++t ) {
+    workers.emplace_back( [&parse, t](){
+      for ( size_t i = 0; i < parses; ++i ) {
+        parse( i * 31 + t );
+      } // end of i-loop
+    } );
+  } // end of t-loop
+  for ( auto & worker : workers ) {
+    worker.join( );
+  }
+  std::chrono::duration<double> seconds = std::chrono::steady_clock::now( ) - start;
+  return threads * parses / seconds.count( ) / 1e6;
+}
+
+// Parse throughput of known names with from_string and with open_enum, and of
+// 500 unknown names interned by open_enum or copied into a std::string, for
+// 1 to N threads, where N is given as argument or defaults to the number of
+// hardware threads
+int main( int argc,
+          char **argv ){
+  auto max_threads = argc > 1 ? static_cast<size_t>( std::atoi( argv[1] ) ) :
+                     static_cast<size_t>( std::thread::hardware_concurrency( ) );
+  if ( max_threads == 0 ) max_threads = 1;
+
+  auto unknown = std::vector<std::string> { };
+  for ( size_t i = 0; i < 500; ++i ) {
+    unknown.push_back( "experimental_codec_" + std::to_string( i ) );
+  } // end of i-loop
+
+  auto known_enum = [&]( size_t i ){
+    auto name = named_enum::names<Codec>()[i % named_enum::size<Codec>()];
+    if ( named_enum::from_string<Codec>( name ) == Codec::av1 && i == 0 ) std::cerr << "unexpected" << std::endl;
+  };
+  auto known_open = [&]( size_t i ){
+    auto name = named_enum::names<Codec>()[i % named_enum::size<Codec>()];
+    if ( !open_codec::from_string( name ).known( ) ) std::cerr << "unexpected" << std::endl;
+  };
+  auto unknown_open = [&]( size_t i ){
+    auto const & name = unknown[i % unknown.size( )];
+    if ( open_codec::from_string( name.c_str( ), name.size( ) ).known( ) ) std::cerr << "unexpected" << std::endl;
+  };
+  auto unknown_string = [&]( size_t i ){
+    auto const & name = unknown[i % unknown.size( )];
+    auto e = Codec { };
+    auto copy = named_enum::try_from_string( name.c_str( ), e ) ? std::string( ) : std::string( name );
+    if ( copy.empty( ) ) std::cerr << "unexpected" << std::endl;
+  };
+
+  std::cout << "threads   known from_string M/s   known open_enum M/s   unknown open_enum M/s   unknown "
+            << "std::string M/s" << std::endl;
+  for ( size_t threads = 1; threads <= max_threads; ++threads ) {
+    std::cout << threads << "   " << throughput( threads, known_enum ) << "   " << throughput( threads, known_open )
+              << "   " << throughput( threads, unknown_open ) << "   " << throughput( threads, unknown_string )
+              << std::endl;
+  } // end of threads-loop
+}
@@ -0,0 +1,89 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_random.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Request, get, put, post, remove, head, options, patch, trace, connect, purge );
+
+constexpr size_t count = 10000000;
+
+constexpr std::uint32_t weights[] = { 40, 20, 10, 8, 7, 5, 4, 3, 2, 1 };
+constexpr named_enum::weighted_sampler<Request> mix { weights };
+
+// Million draws per second filling a column of count values
+template<typename F>
+double draws( std::vector<Request> & column,
+              F && fill ){
+  auto start = std::chrono::steady_clock::now( );
+  fill( column.data( ), column.size( ) );
+  std::chrono::duration<double> seconds = std::chrono::steady_clock::now( ) - start;
+  return column.size( ) / seconds.count( ) / 1e6;
+}
+
+// Draws per second of fill_uniform and of the alias sampler with xorshift64,
+// against std::uniform_int_distribution and std::discrete_distribution with
+// std::mt19937
+int main( ){
+  auto column = std::vector<Request>( count );
+  auto sum = size_t { };
+  auto checksum = [&](){
+    for ( auto value : column ) {
+      sum += static_cast<size_t>( value );
+    }
+  };
+
+  named_enum::xorshift64 g { 42 };
+  std::mt19937 mt { 42 };
+
+  auto uniform = draws( column, [&]( Request * values, size_t n ){
+    named_enum::fill_uniform( values, n, g );
+  } );
+  checksum( );
+  auto std_uniform = draws( column, [&]( Request * values, size_t n ){
+    std::uniform_int_distribution<int> distribution( 0, named_enum::size<Request>() - 1 );
+    for ( size_t i = 0; i < n; ++i ) {
+      values[i] = static_cast<Request>( distribution( mt ) );
+    } // end of i-loop
+  } );
+  checksum( );
+  auto weighted = draws( column, [&]( Request * values, size_t n ){
+    mix.fill( values, n, g );
+  } );
+  checksum( );
+  auto std_weighted = draws( column, [&]( Request * values, size_t n ){
+    std::discrete_distribution<int> distribution( std::begin( weights ), std::end( weights ) );
+    for ( size_t i = 0; i < n; ++i ) {
+      values[i] = static_cast<Request>( distribution( mt ) );
+    } // end of i-loop
+  } );
+  checksum( );
+
+  std::cout << "sampler   M draws/s" << std::endl;
+  std::cout << "fill_uniform   " << uniform << std::endl;
+  std::cout << "std::uniform_int_distribution   " << std_uniform << std::endl;
+  std::cout << "weighted_sampler   " << weighted << std::endl;
+  std::cout << "std::discrete_distribution   " << std_weighted << std::endl;
+  if ( sum == 0 ) std::cerr << "nothing drawn" << std::endl;
+}
@@ -0,0 +1,108 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_scheduler.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Priority, critical, high, normal, low, idle );
+
+constexpr std::uint64_t tasks = 2000000; // per producer
+
+static named_enum::enum_scheduler<Priority, std::uint64_t, 1024> scheduler;
+
+// Same interface with one locked std::deque per class
+class locked_scheduler {
+  std::mutex mutex_;
+  std::deque<std::uint64_t> queues_[named_enum::size<Priority>()];
+
+public:
+  bool try_push( Priority priority,
+                 std::uint64_t task ){
+    std::lock_guard<std::mutex> lock( mutex_ );
+    queues_[static_cast<size_t>( priority )].push_back( task );
+    return true;
+  }
+
+  bool try_pop( std::uint64_t & task ){
+    std::lock_guard<std::mutex> lock( mutex_ );
+    for ( auto & queue : queues_ ) {
+      if ( queue.empty( ) ) continue;
+      task = queue.front( );
+      queue.pop_front( );
+      return true;
+    }
+    return false;
+  }
+};
+
+static locked_scheduler locked;
+
+// Million tasks per second passed from the producers to one consumer
+template<typename Scheduler>
+double throughput( Scheduler & s,
+                   size_t producers ){
+  auto start = std::chrono::steady_clock::now( );
+  auto threads = std::vector<std::thread> { };
+  for ( size_t p = 0; p < producers; ++p ) {
+    threads.emplace_back( [&s](){
+      for ( std::uint64_t i = 0; i < tasks; ++i ) {
+        auto priority = static_cast<Priority>( i % named_enum::size<Priority>() );
+        while ( !s.try_push( priority, i ) ) {
+          std::this_thread::yield( );
+        }
+      } // end of i-loop
+    } );
+  } // end of p-loop
+
+  auto task = std::uint64_t { };
+  for ( std::uint64_t popped = 0; popped < producers * tasks; ) {
+    if ( s.try_pop( task ) ) ++popped;
+    else std::this_thread::yield( );
+  }
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+  std::chrono::duration<double> seconds = std::chrono::steady_clock::now( ) - start;
+  return producers * tasks / seconds.count( ) / 1e6;
+}
+
+// Tasks per second of enum_scheduler and of a mutex protected scheduler for
+// 1 to N producers and one consumer, where N is given as argument or defaults
+// to the number of hardware threads
+int main( int argc,
+          char **argv ){
+  auto max_producers = argc > 1 ? static_cast<size_t>( std::atoi( argv[1] ) ) :
+                       static_cast<size_t>( std::thread::hardware_concurrency( ) );
+  if ( max_producers == 0 ) max_producers = 1;
+
+  std::cout << "producers   enum_scheduler M/s   locked M/s" << std::endl;
+  for ( size_t producers = 1; producers <= max_producers; ++producers ) {
+    auto a = throughput( scheduler, producers );
+    auto b = throughput( locked, producers );
+    std::cout << producers << "   " << a << "   " << b << std::endl;
+  } // end of producers-loop
+}
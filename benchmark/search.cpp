@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_search.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Alert, disk_full, disk_down, disk_slow, disk_denied, disk_timeout, net_full, net_down, net_slow, net_denied, net_timeout, cpu_full, cpu_down, cpu_slow, cpu_denied, cpu_timeout, mem_full, mem_down, mem_slow, mem_denied, mem_timeout, auth_full, auth_down, auth_slow, auth_denied, auth_timeout, db_full, db_down, db_slow, db_denied, db_timeout, cache_full, cache_down, cache_slow, cache_denied, cache_timeout, queue_full, queue_down, queue_slow, queue_denied, queue_timeout, io_full, io_down, io_slow, io_denied, io_timeout, dns_full, dns_down, dns_slow, dns_denied, dns_timeout );
+
+constexpr size_t text_bytes = 64 << 20;
+constexpr size_t chunk_bytes = 64 << 10;
+
+// True if the text has no word character at offset
+bool is_boundary( std::string const & text,
+                  size_t offset ){
+  return offset >= text.size( ) || !named_enum::detail::is_word_character( text[offset] );
+}
+
+// Whole word hits of all names, one strstr loop per name
+size_t strstr_hits( std::string const & text ){
+  auto hits = size_t { };
+  for ( auto name : named_enum::names<Alert>() ) {
+    auto length = std::strlen( name );
+    for ( auto found = std::strstr( text.c_str( ), name ); found != nullptr;
+          found = std::strstr( found + 1, name ) ) {
+      auto offset = static_cast<size_t>( found - text.c_str( ) );
+      if ( ( offset == 0 || is_boundary( text, offset - 1 ) ) && is_boundary( text, offset + length ) ) {
+        ++hits;
+      }
+    }
+  }
+  return hits;
+}
+
+// GB/s of find_all, of name_scanner fed in 64 KiB chunks and of a strstr loop
+// per name over 64 MiB of log lines mentioning the 50 names of Alert
+int main( ){
+  char const * words[] = { "request", "served", "in", "ms", "user", "login", "from", "host", "retry", "ok",
+                           "disk_fullness", "netdown", "status", "queue", "200", "GET", "/index.html" };
+  auto text = std::string { };
+  auto seed = std::uint32_t { 1 };
+  while ( text.size( ) < text_bytes ) {
+    for ( size_t i = 0; i < 12; ++i ) {
+      seed = seed * 1664525u + 1013904223u;
+      auto pick = seed >> 16;
+      if ( pick % 40 == 0 ) text += named_enum::names<Alert>()[pick % named_enum::size<Alert>()];
+      else text += words[pick % ( sizeof( words ) / sizeof( words[0] ) )];
+      text += i + 1 < 12 ? ' ' : '\n';
+    } // end of i-loop
+  }
+
+  auto gigabytes_per_second = [&]( std::chrono::steady_clock::time_point start ){
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now( ) - start;
+    return text.size( ) / seconds.count( ) / 1e9;
+  };
+
+  auto start = std::chrono::steady_clock::now( );
+  auto all = named_enum::find_all<Alert>( text.data( ), text.size( ) ).size( );
+  auto find_all = gigabytes_per_second( start );
+
+  start = std::chrono::steady_clock::now( );
+  auto streamed = size_t { };
+  auto count = [&]( named_enum::name_match<Alert> const & ){
+    ++streamed;
+  };
+  named_enum::name_scanner<Alert> scanner;
+  for ( size_t offset = 0; offset < text.size( ); offset += chunk_bytes ) {
+    scanner.feed( text.data( ) + offset, std::min( chunk_bytes, text.size( ) - offset ), count );
+  } // end of offset-loop
+  scanner.finish( count );
+  auto chunked = gigabytes_per_second( start );
+
+  start = std::chrono::steady_clock::now( );
+  auto naive = strstr_hits( text );
+  auto loop = gigabytes_per_second( start );
+
+  std::cout << "hits   find_all GB/s   name_scanner GB/s   strstr GB/s" << std::endl;
+  std::cout << all << "   " << find_all << "   " << chunked << "   " << loop << std::endl;
+  if ( all != streamed || all != naive ) std::cerr << "hits differ" << std::endl;
+}
@@ -0,0 +1,166 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_suggest.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Setting,
+                       max_size, max_size_bytes, max_count, max_count_bytes, max_level, max_level_bytes,
+                       max_path, max_path_bytes, max_delay, max_delay_bytes, max_limit, max_limit_bytes,
+                       max_mode, max_mode_bytes, max_interval, max_interval_bytes, max_port, max_port_bytes,
+                       max_host, max_host_bytes, min_size, min_size_bytes, min_count, min_count_bytes,
+                       min_level, min_level_bytes, min_path, min_path_bytes, min_delay, min_delay_bytes,
+                       min_limit, min_limit_bytes, min_mode, min_mode_bytes, min_interval,
+                       min_interval_bytes, min_port, min_port_bytes, min_host, min_host_bytes, default_size,
+                       default_size_bytes, default_count, default_count_bytes, default_level,
+                       default_level_bytes, default_path, default_path_bytes, default_delay,
+                       default_delay_bytes, default_limit, default_limit_bytes, default_mode,
+                       default_mode_bytes, default_interval, default_interval_bytes, default_port,
+                       default_port_bytes, default_host, default_host_bytes, enable_size, enable_size_bytes,
+                       enable_count, enable_count_bytes, enable_level, enable_level_bytes, enable_path,
+                       enable_path_bytes, enable_delay, enable_delay_bytes, enable_limit, enable_limit_bytes,
+                       enable_mode, enable_mode_bytes, enable_interval, enable_interval_bytes, enable_port,
+                       enable_port_bytes, enable_host, enable_host_bytes, disable_size, disable_size_bytes,
+                       disable_count, disable_count_bytes, disable_level, disable_level_bytes, disable_path,
+                       disable_path_bytes, disable_delay, disable_delay_bytes, disable_limit,
+                       disable_limit_bytes, disable_mode, disable_mode_bytes, disable_interval,
+                       disable_interval_bytes, disable_port, disable_port_bytes, disable_host,
+                       disable_host_bytes, cache_size, cache_size_bytes, cache_count, cache_count_bytes,
+                       cache_level, cache_level_bytes, cache_path, cache_path_bytes, cache_delay,
+                       cache_delay_bytes, cache_limit, cache_limit_bytes, cache_mode, cache_mode_bytes,
+                       cache_interval, cache_interval_bytes, cache_port, cache_port_bytes, cache_host,
+                       cache_host_bytes, log_size, log_size_bytes, log_count, log_count_bytes, log_level,
+                       log_level_bytes, log_path, log_path_bytes, log_delay, log_delay_bytes, log_limit,
+                       log_limit_bytes, log_mode, log_mode_bytes, log_interval, log_interval_bytes, log_port,
+                       log_port_bytes, log_host, log_host_bytes, retry_size, retry_size_bytes, retry_count,
+                       retry_count_bytes, retry_level, retry_level_bytes, retry_path, retry_path_bytes,
+                       retry_delay, retry_delay_bytes, retry_limit, retry_limit_bytes, retry_mode,
+                       retry_mode_bytes, retry_interval, retry_interval_bytes, retry_port, retry_port_bytes,
+                       retry_host, retry_host_bytes, timeout_size, timeout_size_bytes, timeout_count,
+                       timeout_count_bytes, timeout_level, timeout_level_bytes, timeout_path,
+                       timeout_path_bytes, timeout_delay, timeout_delay_bytes, timeout_limit,
+                       timeout_limit_bytes, timeout_mode, timeout_mode_bytes, timeout_interval,
+                       timeout_interval_bytes, timeout_port, timeout_port_bytes, timeout_host,
+                       timeout_host_bytes, buffer_size, buffer_size_bytes, buffer_count, buffer_count_bytes,
+                       buffer_level, buffer_level_bytes, buffer_path, buffer_path_bytes, buffer_delay,
+                       buffer_delay_bytes, buffer_limit, buffer_limit_bytes, buffer_mode, buffer_mode_bytes,
+                       buffer_interval, buffer_interval_bytes, buffer_port, buffer_port_bytes, buffer_host,
+                       buffer_host_bytes, thread_size, thread_size_bytes, thread_count, thread_count_bytes,
+                       thread_level, thread_level_bytes, thread_path, thread_path_bytes, thread_delay,
+                       thread_delay_bytes, thread_limit, thread_limit_bytes, thread_mode, thread_mode_bytes,
+                       thread_interval, thread_interval_bytes, thread_port, thread_port_bytes, thread_host,
+                       thread_host_bytes, queue_size, queue_size_bytes, queue_count, queue_count_bytes,
+                       queue_level, queue_level_bytes, queue_path, queue_path_bytes, queue_delay,
+                       queue_delay_bytes, queue_limit, queue_limit_bytes, queue_mode, queue_mode_bytes,
+                       queue_interval, queue_interval_bytes, queue_port, queue_port_bytes, queue_host,
+                       queue_host_bytes, socket_size, socket_size_bytes, socket_count, socket_count_bytes,
+                       socket_level, socket_level_bytes, socket_path, socket_path_bytes, socket_delay,
+                       socket_delay_bytes, socket_limit, socket_limit_bytes, socket_mode, socket_mode_bytes,
+                       socket_interval, socket_interval_bytes, socket_port, socket_port_bytes, socket_host,
+                       socket_host_bytes, file_size, file_size_bytes, file_count, file_count_bytes,
+                       file_level, file_level_bytes, file_path, file_path_bytes, file_delay,
+                       file_delay_bytes, file_limit, file_limit_bytes, file_mode, file_mode_bytes,
+                       file_interval, file_interval_bytes, file_port, file_port_bytes, file_host,
+                       file_host_bytes, user_size, user_size_bytes, user_count, user_count_bytes, user_level,
+                       user_level_bytes, user_path, user_path_bytes, user_delay, user_delay_bytes,
+                       user_limit, user_limit_bytes, user_mode, user_mode_bytes, user_interval,
+                       user_interval_bytes, user_port, user_port_bytes, user_host, user_host_bytes,
+                       server_size, server_size_bytes, server_count, server_count_bytes, server_level,
+                       server_level_bytes, server_path, server_path_bytes, server_delay, server_delay_bytes,
+                       server_limit, server_limit_bytes, server_mode, server_mode_bytes, server_interval,
+                       server_interval_bytes, server_port, server_port_bytes, server_host, server_host_bytes,
+                       client_size, client_size_bytes, client_count, client_count_bytes, client_level,
+                       client_level_bytes, client_path, client_path_bytes, client_delay, client_delay_bytes,
+                       client_limit, client_limit_bytes, client_mode, client_mode_bytes, client_interval,
+                       client_interval_bytes, client_port, client_port_bytes, client_host, client_host_bytes,
+                       proxy_size, proxy_size_bytes, proxy_count, proxy_count_bytes, proxy_level,
+                       proxy_level_bytes, proxy_path, proxy_path_bytes, proxy_delay, proxy_delay_bytes,
+                       proxy_limit, proxy_limit_bytes, proxy_mode, proxy_mode_bytes, proxy_interval,
+                       proxy_interval_bytes, proxy_port, proxy_port_bytes, proxy_host, proxy_host_bytes,
+                       token_size, token_size_bytes, token_count, token_count_bytes, token_level,
+                       token_level_bytes, token_path, token_path_bytes, token_delay, token_delay_bytes,
+                       token_limit, token_limit_bytes, token_mode, token_mode_bytes, token_interval,
+                       token_interval_bytes, token_port, token_port_bytes, token_host, token_host_bytes,
+                       session_size, session_size_bytes, session_count, session_count_bytes, session_level,
+                       session_level_bytes, session_path, session_path_bytes, session_delay,
+                       session_delay_bytes, session_limit, session_limit_bytes, session_mode,
+                       session_mode_bytes, session_interval, session_interval_bytes, session_port,
+                       session_port_bytes, session_host, session_host_bytes );
+
+constexpr size_t k = 3;
+constexpr size_t rounds = 20;
+
+// The k nearest names by a dynamic programming scan over all names
+std::vector<Setting> scan( char const * input,
+                           size_t length ){
+  auto best = std::vector<std::pair<size_t, size_t>> { };
+  for ( size_t i = 0; i < named_enum::size<Setting>(); ++i ) {
+    auto name = named_enum::names<Setting>()[i];
+    best.emplace_back( named_enum::detail::edit_distance( input, length, name, std::strlen( name ) ), i );
+  } // end of i-loop
+  std::partial_sort( best.begin( ), best.begin( ) + k, best.end( ) );
+  auto result = std::vector<Setting> { };
+  for ( size_t i = 0; i < k; ++i ) {
+    result.push_back( static_cast<Setting>( best[i].second ) );
+  } // end of i-loop
+  return result;
+}
+
+// Microseconds per query of nearest_names and of a dynamic programming scan
+// over the 400 names of Setting, for misspelled names
+int main( ){
+  auto queries = std::vector<std::string> { };
+  for ( size_t i = 0; i < named_enum::size<Setting>(); i += 7 ) {
+    auto query = std::string( named_enum::names<Setting>()[i] );
+    query.erase( i % query.size( ), 1 );             // drop a character
+    query[( i * 3 ) % query.size( )] = 'x';          // and replace one
+    queries.push_back( query );
+  } // end of i-loop
+
+  auto agree = size_t { };
+  auto time = [&]( bool fast ){
+    auto start = std::chrono::steady_clock::now( );
+    for ( size_t r = 0; r < rounds; ++r ) {
+      for ( auto const & query : queries ) {
+        auto nearest = fast ? named_enum::nearest_names<Setting>( query.c_str( ), query.size( ), k ) :
+                       scan( query.c_str( ), query.size( ) );
+        agree += static_cast<size_t>( nearest.front( ) );
+      }
+    } // end of r-loop
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now( ) - start;
+    return elapsed.count( ) / ( rounds * queries.size( ) );
+  };
+
+  auto fast = time( true );
+  auto fast_sum = agree;
+  agree = 0;
+  auto slow = time( false );
+
+  std::cout << "names   nearest_names us   scan us" << std::endl;
+  std::cout << named_enum::size<Setting>() << "   " << fast << "   " << slow << std::endl;
+  if ( fast_sum != agree ) std::cerr << "nearest names differ" << std::endl;
+}
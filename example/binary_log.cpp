@@ -0,0 +1,68 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_log.hpp"
+#include "order.hpp"
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+// One ring per logging thread
+static named_enum::log_ring<1024> ring;
+static std::atomic<bool> done { false };
+
+int main( int argc,
+          char **argv ){
+  // The hot thread only copies fingerprint, code and a sequence number
+  std::thread trader( [](){
+    for ( std::uint64_t i = 0; i < 8; ++i ) {
+      while ( !named_enum::log_enum( ring, static_cast<Order>( i % 4 ), i ) ) {
+        std::this_thread::yield( );
+      }
+    } // end of i-loop
+    done = true;
+  } );
+
+  // The background thread resolves names, e.g. before writing a text log, or
+  // writes the raw records to the file given as argument, which is decoded
+  // offline by log_decode
+  auto decoder = named_enum::log_decoder { };
+  decoder.add<Order>( );
+
+  auto file = std::ofstream { };
+  if ( argc > 1 ) file.open( argv[1], std::ios::binary );
+
+  auto print = [&]( named_enum::log_record const & record ){
+    if ( file.is_open( ) ) {
+      file.write( reinterpret_cast<char const *>( &record ), sizeof( record ) );
+    }
+    else {
+      std::cout << record.stamp << " : " << decoder.name( record ) << std::endl;
+    }
+  };
+  while ( !done ) {
+    if ( ring.drain( print ) == 0 ) std::this_thread::yield( );
+  }
+  ring.drain( print );
+
+  trader.join( );
+}
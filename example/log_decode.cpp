@@ -0,0 +1,59 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_log.hpp"
+#include "order.hpp"
+#include <fstream>
+#include <iostream>
+
+// Decodes a file of raw log records written by binary_log with the names of
+// the enums registered here. Records are read in the byte order they were
+// written in, so the file must come from a machine with the same byte order.
+int main( int argc,
+          char **argv ){
+  if ( argc != 2 ) {
+    std::cerr << "usage: " << argv[0] << " <log file>" << std::endl;
+    return 1;
+  }
+  auto file = std::ifstream( argv[1], std::ios::binary );
+  if ( !file ) {
+    std::cerr << "cannot open " << argv[1] << std::endl;
+    return 1;
+  }
+
+  auto decoder = named_enum::log_decoder { };
+  decoder.add<Order>( );
+
+  auto record = named_enum::log_record { };
+  while ( file.read( reinterpret_cast<char *>( &record ), sizeof( record ) ) ) {
+    std::cout << record.stamp << " : ";
+    if ( decoder.knows( record.type ) ) {
+      std::cout << decoder.name( record ) << std::endl;
+    }
+    else {
+      std::cout << "unknown enum " << std::hex << record.type << std::dec << " code " << record.code << std::endl;
+    }
+  }
+  if ( file.gcount( ) != 0 ) {
+    std::cerr << "trailing partial record" << std::endl;
+    return 1;
+  }
+}
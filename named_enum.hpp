@@ -1,10 +1,21 @@
+#ifndef NAMED_ENUM_HPP
+#define NAMED_ENUM_HPP
+
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace named_enum {
 
 using string_t=const char *;
 
+/// Trait telling whether E was created by one of the named enum macros
+template<typename E>
+struct is_named_enum : std::false_type { };
+
 /// Size interface
 template<typename E> constexpr
 size_t size( );
@@ -29,11 +40,42 @@ const typename enum_name_traits<E>::string_array_t & names( E const & ) {
   return names<E>( );
 }
 
+template<typename E> constexpr
+string_t checked_name( E const & e );
+
+/// Defining NAMED_ENUM_HARDENED_NAME makes name() return NAMED_ENUM_INVALID_NAME
+/// for values that do not denote an enumerator
 template<typename E> constexpr
 string_t name( E const & e ){
+#ifdef NAMED_ENUM_HARDENED_NAME
+  return checked_name( e );
+#else
   return names( e )[static_cast<size_t>(e)];
+#endif
 }
 
+/// Alias interface, specialized by MAKE_NAMED_ENUM_ALIASES. The strings hold
+/// pairs of an alias spelling followed by the enumerator it stands for.
+template<typename E>
+struct enum_alias_traits{
+  static constexpr size_t size=0;
+
+  static constexpr string_t const * strings( ){
+    return nullptr;
+  }
+};
+
+/// Transition interface, specialized by MAKE_NAMED_ENUM_TRANSITIONS. The
+/// strings hold pairs of the names of a source and a target enumerator.
+template<typename E>
+struct enum_transition_traits{
+  static constexpr size_t size=0;
+
+  static constexpr string_t const * strings( ){
+    return nullptr;
+  }
+};
+
 namespace detail {
 
 template<size_t N>
@@ -62,6 +104,32 @@ constexpr bool has_trailing_comma( char const (&string)[N] ){
 }
 
 
+template<size_t N>
+constexpr size_t count_separated( char const (&string)[N],
+                                  char separator ){
+  return empty( string ) ? 0 : count_character( string, separator ) + 1;
+}
+
+constexpr bool is_separator( char character ){
+  return character == ',' || character == '=' || character == '-' || character == '>' ||
+         character == ' ' || character == '\t' || character == '\n';
+}
+
+constexpr size_t string_length( char const * string ){
+  auto count=size_t {};
+  while ( string[count] != '\0' ) ++count;
+  return count;
+}
+
+constexpr bool equal( char const * lhs,
+                      char const * rhs,
+                      size_t length ){
+  for ( size_t i = 0; i < length; ++i ) {
+    if ( lhs[i] != rhs[i] ) return false;
+  } // end of i-loop
+  return true;
+}
+
 template<std::size_t... I>
 constexpr std::array<string_t,sizeof...(I)> make_array( char * string,
                                                         char ** ids,
@@ -69,24 +137,30 @@ constexpr std::array<string_t,sizeof...(I)> make_array( char * string,
     return std::array<string_t,sizeof...(I)>{ids[I]...};
 }
 
+/// Splits a stringified argument list into C null-terminated tokens. Commas,
+/// equal signs, arrows and whitespace separate tokens and are never part of one.
 template<int N, size_t C>
 class tokenizer {
   using string_array_t=std::array<string_t,C>;
+
+public:
+  // Public, since GCC checks access to the members a constant points into
+  // when the tokenizer is a static member of a class template
   char string_[N] { };
   char * ids_[C] { };
   string_array_t strings_{};
 
-public:
   constexpr tokenizer( char const (&string)[N] ){
     size_t count = 0;
-    ids_[0]= &string_[0];
     for ( size_t i = 0; i < N; ++i ) {
-      if ( string[i] == ',' ) {
-        ids_[++count] = &string_[i + 2];
+      if ( is_separator( string[i] ) || string[i] == '\0' ) {
         string_[i] = '\0';
       }
       else {
         string_[i] = string[i];
+        if ( i == 0 || string_[i - 1] == '\0' ) {
+          ids_[count++] = &string_[i];
+        }
       }
     } // end of i-loop
 
@@ -100,9 +174,923 @@ public:
   }
 };
 
+/// Lexicographic comparison of two strings of given lengths, returning a
+/// negative, zero or positive value like std::strcmp
+constexpr int compare( char const * lhs,
+                       size_t lhs_length,
+                       char const * rhs,
+                       size_t rhs_length ){
+  for ( size_t i = 0; i < lhs_length && i < rhs_length; ++i ) {
+    auto l = static_cast<unsigned char>( lhs[i] );
+    auto r = static_cast<unsigned char>( rhs[i] );
+    if ( l != r ) return l < r ? -1 : 1;
+  } // end of i-loop
+  return lhs_length < rhs_length ? -1 : ( lhs_length > rhs_length ? 1 : 0 );
+}
+
+/// Reverse lookup table holding the enumerator names and the aliases, sorted
+/// lexicographically, each with its length and the index of the enumerator
+/// it resolves to.
+template<typename E>
+class parse_table {
+public:
+  static constexpr size_t C=size<E>()+enum_alias_traits<E>::size;
+
+private:
+  string_t strings_[C] { };
+  size_t lengths_[C] { };
+  size_t indices_[C] { };
+
+  constexpr size_t find_name( char const * string,
+                              size_t length ) const{
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      if ( lengths_[i] == length && equal( strings_[i], string, length ) ) {
+        return indices_[i];
+      }
+    } // end of i-loop
+    return size<E>();
+  }
+
+  constexpr void swap( size_t i,
+                       size_t j ){
+    auto string = strings_[i];
+    strings_[i] = strings_[j];
+    strings_[j] = string;
+    auto length = lengths_[i];
+    lengths_[i] = lengths_[j];
+    lengths_[j] = length;
+    auto index = indices_[i];
+    indices_[i] = indices_[j];
+    indices_[j] = index;
+  }
+
+  constexpr bool less( size_t i,
+                       size_t j ) const{
+    return compare( strings_[i], lengths_[i], strings_[j], lengths_[j] ) < 0;
+  }
+
+  constexpr void sift_down( size_t root,
+                            size_t end ){
+    for ( auto child = 2 * root + 1; child < end; child = 2 * root + 1 ) {
+      if ( child + 1 < end && less( child, child + 1 ) ) ++child;
+      if ( !less( root, child ) ) return;
+      swap( root, child );
+      root = child;
+    }
+  }
+
+public:
+  constexpr parse_table( ){
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      strings_[i] = names<E>()[i];
+      lengths_[i] = string_length( strings_[i] );
+      indices_[i] = i;
+    } // end of i-loop
+
+    for ( size_t i = 0; i < enum_alias_traits<E>::size; ++i ) {
+      auto alias = enum_alias_traits<E>::strings()[2 * i];
+      auto target = enum_alias_traits<E>::strings()[2 * i + 1];
+      strings_[size<E>() + i] = alias;
+      lengths_[size<E>() + i] = string_length( alias );
+      indices_[size<E>() + i] = find_name( target, string_length( target ) );
+    } // end of i-loop
+
+    // Heap sort, keeping the compile time cost of large enums in check
+    for ( size_t i = C / 2; i > 0; --i ) {
+      sift_down( i - 1, C );
+    } // end of i-loop
+    for ( size_t end = C; end > 1; --end ) {
+      swap( 0, end - 1 );
+      sift_down( 0, end - 1 );
+    } // end of end-loop
+  }
+
+  constexpr string_t string( size_t i ) const{
+    return strings_[i];
+  }
+
+  constexpr size_t length( size_t i ) const{
+    return lengths_[i];
+  }
+
+  constexpr size_t index( size_t i ) const{
+    return indices_[i];
+  }
+
+  /// Index of the enumerator spelled by string or size<E>() if there is none
+  constexpr size_t find( char const * string,
+                         size_t length ) const{
+    size_t first = 0;
+    size_t last = C;
+    while ( first < last ) {
+      auto middle = first + ( last - first ) / 2;
+      auto order = compare( strings_[middle], lengths_[middle], string, length );
+      if ( order == 0 ) return indices_[middle];
+      if ( order < 0 ) first = middle + 1;
+      else last = middle;
+    }
+    return size<E>();
+  }
+
+  constexpr size_t max_length( ) const{
+    auto result = size_t { };
+    for ( size_t i = 0; i < C; ++i ) {
+      if ( lengths_[i] > result ) result = lengths_[i];
+    } // end of i-loop
+    return result;
+  }
+
+  /// True if every alias names an enumerator and no spelling occurs twice
+  constexpr bool consistent( ) const{
+    for ( size_t i = 0; i < C; ++i ) {
+      if ( indices_[i] == size<E>() ) return false;
+      if ( i > 0 && compare( strings_[i - 1], lengths_[i - 1],
+                             strings_[i], lengths_[i] ) == 0 ) return false;
+    } // end of i-loop
+    return true;
+  }
+};
+
+template<typename E>
+constexpr parse_table<E> parse_table_v{};
+
+/// Smallest unsigned type able to hold values up to N
+template<size_t N>
+using small_index_t=std::conditional_t<( N <= UINT8_MAX ), std::uint8_t,
+                    std::conditional_t<( N <= UINT16_MAX ), std::uint16_t,
+                                                            std::uint32_t>>;
+
+/// Necessary conditions for a spelling of E built from the parse table: its
+/// length, first and last character must occur in a name or alias. Defining
+/// NAMED_ENUM_BLOOM_FILTER adds a 512 bit Bloom filter over the length and
+/// the first two and the last character, which is rarely worth it for a
+/// few names but rejects more similar tokens of large enums.
+template<typename E>
+class name_filter {
+  std::uint64_t lengths_ { }; // lengths of 63 and more share the last bit
+  std::uint64_t firsts_[4] { };
+  std::uint64_t lasts_[4] { };
+#ifdef NAMED_ENUM_BLOOM_FILTER
+  std::uint64_t bloom_[8] { };
+#endif
+
+  static constexpr size_t length_bit( size_t length ){
+    return length < 63 ? length : 63;
+  }
+
+  static constexpr bool test( std::uint64_t const * bits,
+                              size_t bit ){
+    return ( bits[bit / 64] >> bit % 64 & 1 ) != 0;
+  }
+
+  static constexpr void set( std::uint64_t * bits,
+                             size_t bit ){
+    bits[bit / 64] |= std::uint64_t { 1 } << bit % 64;
+  }
+
+  /// Two bit positions from characters and the length, no hash of the name
+  static constexpr std::uint32_t bloom_key( char const * string,
+                                            size_t length ){
+    return ( static_cast<std::uint32_t>( static_cast<unsigned char>( string[0] ) ) |
+             static_cast<std::uint32_t>( static_cast<unsigned char>( string[length > 1 ? 1 : 0] ) ) << 8 |
+             static_cast<std::uint32_t>( static_cast<unsigned char>( string[length - 1] ) ) << 16 ) ^
+           static_cast<std::uint32_t>( length ) * 0x9e3779b9u;
+  }
+
+  static constexpr size_t bloom_bit( std::uint32_t key,
+                                     int which ){
+    return ( key * ( which == 0 ? 0x85ebca6bu : 0xc2b2ae35u ) ) >> 23;
+  }
+
+public:
+  constexpr name_filter( ){
+    for ( size_t i = 0; i < parse_table<E>::C; ++i ) {
+      auto string = parse_table_v<E>.string( i );
+      auto length = parse_table_v<E>.length( i );
+      lengths_ |= std::uint64_t { 1 } << length_bit( length );
+      set( firsts_, static_cast<unsigned char>( string[0] ) );
+      set( lasts_, static_cast<unsigned char>( string[length - 1] ) );
+#ifdef NAMED_ENUM_BLOOM_FILTER
+      set( bloom_, bloom_bit( bloom_key( string, length ), 0 ) );
+      set( bloom_, bloom_bit( bloom_key( string, length ), 1 ) );
+#endif
+    } // end of i-loop
+  }
+
+  constexpr bool might_contain( char const * string,
+                                size_t length ) const{
+    if ( ( lengths_ >> length_bit( length ) & 1 ) == 0 ) return false;
+    if ( !test( firsts_, static_cast<unsigned char>( string[0] ) ) ) return false;
+    if ( !test( lasts_, static_cast<unsigned char>( string[length - 1] ) ) ) return false;
+#ifdef NAMED_ENUM_BLOOM_FILTER
+    auto key = bloom_key( string, length );
+    return test( bloom_, bloom_bit( key, 0 ) ) && test( bloom_, bloom_bit( key, 1 ) );
+#else
+    return true;
+#endif
+  }
+};
+
+template<typename E>
+constexpr name_filter<E> name_filter_v{};
+
+} // namespace detail
+
+/// False if string cannot be a name or alias of E, decided by a few bit
+/// tests without looking at more than three characters. True does not
+/// imply that it is one.
+template<typename E> constexpr
+bool might_be_name( char const * string,
+                    size_t length ){
+  return detail::name_filter_v<E>.might_contain( string, length );
+}
+
+template<typename E> constexpr
+bool might_be_name( char const * string ){
+  return might_be_name<E>( string, detail::string_length( string ) );
+}
+
+/// Parse interface, accepting enumerator names and their aliases
+template<typename E> constexpr
+bool try_from_string( char const * string,
+                      size_t length,
+                      E & e ){
+  if ( !might_be_name<E>( string, length ) ) return false;
+  auto index = detail::parse_table_v<E>.find( string, length );
+  if ( index == size<E>() ) return false;
+  e = static_cast<E>( index );
+  return true;
+}
+
+template<typename E> constexpr
+bool try_from_string( char const * string,
+                      E & e ){
+  return try_from_string( string, detail::string_length( string ), e );
+}
+
+template<typename E> constexpr
+E from_string( char const * string,
+               size_t length ){
+  auto e = E { };
+  return try_from_string( string, length, e ) ? e :
+         throw std::invalid_argument( "Unknown enumerator name" );
+}
+
+template<typename E> constexpr
+E from_string( char const * string ){
+  return from_string<E>( string, detail::string_length( string ) );
+}
+
+/// Underlying value interface
+template<typename E>
+using underlying_t=std::underlying_type_t<E>;
+
+template<typename E> constexpr
+bool is_valid( underlying_t<E> value ){
+  return static_cast<std::make_unsigned_t<underlying_t<E>>>( value ) < size<E>();
+}
+
+template<typename E> constexpr
+bool try_from_underlying( underlying_t<E> value,
+                          E & e ){
+  if ( !is_valid<E>( value ) ) return false;
+  e = static_cast<E>( value );
+  return true;
+}
+
+template<typename E> constexpr
+E from_underlying( underlying_t<E> value ){
+  return is_valid<E>( value ) ? static_cast<E>( value ) :
+         throw std::out_of_range( "Value does not denote an enumerator" );
+}
+
+namespace detail {
+
+#ifndef NAMED_ENUM_INVALID_NAME
+#define NAMED_ENUM_INVALID_NAME "<invalid>"
+#endif
+
+/// The names followed by one sentinel entry that out-of-range values are
+/// clamped to, so checked lookups compile to a conditional move
+template<typename E>
+class checked_name_table {
+  string_t strings_[size<E>() + 1] { };
+
+public:
+  constexpr checked_name_table( ){
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      strings_[i] = names<E>()[i];
+    } // end of i-loop
+    strings_[size<E>()] = NAMED_ENUM_INVALID_NAME;
+  }
+
+  constexpr string_t operator[]( size_t i ) const{
+    return strings_[i < size<E>() ? i : size<E>()];
+  }
+};
+
+template<typename E>
+constexpr checked_name_table<E> checked_name_table_v{};
+
+template<typename E> constexpr
+size_t unsigned_index( E const & e ){
+  return static_cast<std::make_unsigned_t<underlying_t<E>>>( e );
+}
+
 } // namespace detail
+
+/// Name of e or NAMED_ENUM_INVALID_NAME if e does not denote an enumerator
+template<typename E> constexpr
+string_t checked_name( E const & e ){
+  return detail::checked_name_table_v<E>[detail::unsigned_index( e )];
+}
+
+/// Name of e or fallback if e does not denote an enumerator
+template<typename E> constexpr
+string_t name_or( E const & e,
+                  string_t fallback ){
+  return detail::unsigned_index( e ) < size<E>() ? names( e )[detail::unsigned_index( e )] :
+                                                   fallback;
+}
+
+/// Index of the first of count values that does not denote an enumerator, or
+/// count if all are valid. Blocks are checked without branching per value,
+/// which compilers turn into vector compares.
+template<typename E>
+size_t validate( underlying_t<E> const * values,
+                 size_t count ){
+  using unsigned_t=std::make_unsigned_t<underlying_t<E>>;
+  constexpr size_t block = 64;
+  constexpr auto limit = static_cast<unsigned_t>( size<E>() - 1 );
+
+  size_t begin = 0;
+  for ( ; begin + block <= count; begin += block ) {
+    auto largest = unsigned_t { };
+    for ( size_t i = begin; i < begin + block; ++i ) {
+      auto value = static_cast<unsigned_t>( values[i] );
+      largest = value > largest ? value : largest;
+    } // end of i-loop
+    if ( largest > limit ) break;
+  } // end of block-loop
+
+  for ( size_t i = begin; i < count; ++i ) {
+    if ( !is_valid<E>( values[i] ) ) return i;
+  } // end of i-loop
+  return count;
+}
+
+namespace literals {
+
+/// Name literal converting to whichever named enum it initializes. Used in a
+/// constant expression, an unknown name is a compile error quoting the literal.
+class enum_literal {
+  char const * string_;
+  size_t length_;
+
+public:
+  constexpr enum_literal( char const * string,
+                          size_t length ) :
+          string_( string ), length_( length ){
+  }
+
+  template<typename E, typename=std::enable_if_t<is_named_enum<E>::value>>
+  constexpr operator E( ) const{
+    return from_string<E>( string_, length_ );
+  }
+};
+
+constexpr enum_literal operator""_enum( char const * string,
+                                        size_t length ){
+  return enum_literal( string, length );
+}
+
+} // namespace literals
+
+/// Incremental matcher interface
+enum class match_status { dead, partial, match };
+
+/// Matches names and aliases of E one character at a time, e.g. when a name
+/// arrives split across several buffers. The state is a range of the sorted
+/// parse table plus the number of consumed characters, a few bytes in total.
+template<typename E>
+class prefix_matcher {
+  using table_t=detail::parse_table<E>;
+  using index_t=detail::small_index_t<( table_t::C > detail::parse_table_v<E>.max_length() ?
+                                        table_t::C : detail::parse_table_v<E>.max_length() )>;
+  index_t first_ { };
+  index_t last_ { table_t::C };
+  index_t depth_ { };
+
+  static constexpr table_t const & table( ){
+    return detail::parse_table_v<E>;
+  }
+
+  static constexpr unsigned char character( size_t i,
+                                            size_t depth ){
+    return static_cast<unsigned char>( table().string( i )[depth] );
+  }
+
+public:
+  /// Consumes the next character and narrows the candidates
+  constexpr match_status step( char next ){
+    if ( first_ == last_ ) return match_status::dead;
+
+    auto c = static_cast<unsigned char>( next );
+    size_t first = first_;
+    size_t last = last_;
+    // Only the first candidate can end here, the rest are ordered by character
+    if ( table().length( first ) == depth_ ) ++first;
+
+    auto lower = first;
+    auto upper = last;
+    while ( lower < upper ) {
+      auto middle = lower + ( upper - lower ) / 2;
+      if ( character( middle, depth_ ) < c ) lower = middle + 1;
+      else upper = middle;
+    }
+    first = lower;
+    upper = last;
+    while ( lower < upper ) {
+      auto middle = lower + ( upper - lower ) / 2;
+      if ( character( middle, depth_ ) <= c ) lower = middle + 1;
+      else upper = middle;
+    }
+    last = lower;
+
+    first_ = static_cast<index_t>( first );
+    last_ = static_cast<index_t>( last );
+    if ( first_ != last_ ) ++depth_;
+    return status( );
+  }
+
+  /// Consumes length characters
+  constexpr match_status feed( char const * string,
+                               size_t length ){
+    for ( size_t i = 0; i < length && first_ != last_; ++i ) {
+      step( string[i] );
+    } // end of i-loop
+    return status( );
+  }
+
+  constexpr void reset( ){
+    first_ = 0;
+    last_ = table_t::C;
+    depth_ = 0;
+  }
+
+  /// Dead if no name starts with the input, match if the input is a name or
+  /// alias and partial otherwise
+  constexpr match_status status( ) const{
+    if ( first_ == last_ ) return match_status::dead;
+    return table().length( first_ ) == depth_ ? match_status::match :
+                                                match_status::partial;
+  }
+
+  /// Number of consumed characters of a live match
+  constexpr size_t depth( ) const{
+    return depth_;
+  }
+
+  /// Resolves an exact match or else a prefix shared only by spellings of
+  /// the same enumerator
+  constexpr bool resolve( E & e ) const{
+    if ( first_ == last_ ) return false;
+    auto index = table().index( first_ );
+    if ( table().length( first_ ) != depth_ ) {
+      for ( size_t i = first_ + 1u; i < last_; ++i ) {
+        if ( table().index( i ) != index ) return false;
+      } // end of i-loop
+    }
+    e = static_cast<E>( index );
+    return true;
+  }
+};
+
+/// Parses exact names and unique abbreviations
+template<typename E> constexpr
+bool try_from_prefix( char const * string,
+                      size_t length,
+                      E & e ){
+  auto matcher = prefix_matcher<E> { };
+  if ( length == 0 || matcher.feed( string, length ) == match_status::dead ) return false;
+  return matcher.resolve( e );
+}
+
+template<typename E> constexpr
+bool try_from_prefix( char const * string,
+                      E & e ){
+  return try_from_prefix( string, detail::string_length( string ), e );
+}
+
+template<typename E> constexpr
+E from_prefix( char const * string,
+               size_t length ){
+  auto e = E { };
+  return try_from_prefix( string, length, e ) ? e :
+         throw std::invalid_argument( "Unknown or ambiguous enumerator prefix" );
+}
+
+template<typename E> constexpr
+E from_prefix( char const * string ){
+  return from_prefix<E>( string, detail::string_length( string ) );
+}
+
+namespace detail {
+
+constexpr std::uint64_t fnv1a_64_offset = 14695981039346656037ull;
+constexpr std::uint64_t fnv1a_64_prime = 1099511628211ull;
+
+/// Continues a 64 bit FNV-1a hash over length characters
+constexpr std::uint64_t fnv1a_64( std::uint64_t hash,
+                                  char const * string,
+                                  size_t length ){
+  for ( size_t i = 0; i < length; ++i ) {
+    hash = ( hash ^ static_cast<unsigned char>( string[i] ) ) * fnv1a_64_prime;
+  } // end of i-loop
+  return hash;
+}
+
+template<typename E> constexpr
+std::uint64_t compute_fingerprint( ){
+  auto hash = fnv1a_64_offset;
+  for ( size_t i = 0; i < size<E>(); ++i ) {
+    hash = fnv1a_64( hash, names<E>()[i], string_length( names<E>()[i] ) + 1 );
+  } // end of i-loop
+  return hash;
+}
+
+template<typename E>
+constexpr std::uint64_t fingerprint_v=compute_fingerprint<E>( );
+
+} // namespace detail
+
+/// Fingerprint interface. The 64 bit FNV-1a hash of all names in order, each
+/// including its null-terminator. It changes whenever an enumerator is added,
+/// removed, renamed or moved, but not with aliases or the underlying type.
+template<typename E> constexpr
+std::uint64_t fingerprint( ){
+  return detail::fingerprint_v<E>;
+}
+
+template<typename E> constexpr
+std::uint64_t fingerprint( E const & ){
+  return fingerprint<E>( );
+}
+
+namespace detail {
+
+constexpr std::uint32_t fnv1a_32_offset = 2166136261u;
+constexpr std::uint32_t fnv1a_32_prime = 16777619u;
+
+constexpr std::uint32_t fnv1a_32( char const * string,
+                                  size_t length ){
+  auto hash = fnv1a_32_offset;
+  for ( size_t i = 0; i < length; ++i ) {
+    hash = ( hash ^ static_cast<unsigned char>( string[i] ) ) * fnv1a_32_prime;
+  } // end of i-loop
+  return hash;
+}
+
+/// Finalizer of MurmurHash3, used to spread a name hash over the slots
+constexpr std::uint32_t mix_32( std::uint32_t hash ){
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+constexpr size_t power_of_two_ceil( size_t n ){
+  auto result = size_t { 1 };
+  while ( result < n ) result *= 2;
+  return result;
+}
+
+/// Perfect hash from name hashes to enumerator indices built by hash and
+/// displace: the low bits of a name hash select a bucket, whose displacement
+/// is chosen such that all of its hashes land in distinct, otherwise empty
+/// slots. A lookup therefore probes exactly one slot.
+template<typename E>
+class name_hash_table {
+  static constexpr size_t B=power_of_two_ceil( size<E>() ) / 2 + 1;
+  static constexpr size_t S=power_of_two_ceil( 2 * size<E>() );
+
+  std::uint32_t hashes_[size<E>()] { };
+  std::uint32_t displacements_[B] { };
+  std::uint32_t slot_hashes_[S] { };
+  size_t slot_indices_[S] { };
+
+  static constexpr size_t bucket( std::uint32_t hash ){
+    return hash % B;
+  }
+
+  static constexpr size_t slot( std::uint32_t hash,
+                                std::uint32_t displacement ){
+    return mix_32( hash + displacement * 0x9e3779b9u ) & ( S - 1 );
+  }
+
+  constexpr bool place( size_t b,
+                        std::uint32_t displacement ){
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      if ( bucket( hashes_[i] ) != b ) continue;
+      auto s = slot( hashes_[i], displacement );
+      if ( slot_indices_[s] != size<E>() ) {
+        for ( size_t j = 0; j < i; ++j ) { // undo
+          if ( bucket( hashes_[j] ) == b ) slot_indices_[slot( hashes_[j], displacement )] = size<E>();
+        } // end of j-loop
+        return false;
+      }
+      slot_indices_[s] = i;
+      slot_hashes_[s] = hashes_[i];
+    } // end of i-loop
+    return true;
+  }
+
+public:
+  constexpr name_hash_table( ){
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      hashes_[i] = fnv1a_32( names<E>()[i], string_length( names<E>()[i] ) );
+      for ( size_t j = 0; j < i; ++j ) {
+        if ( hashes_[j] == hashes_[i] ) throw std::logic_error( "Name hashes collide" );
+      } // end of j-loop
+    } // end of i-loop
+
+    for ( size_t s = 0; s < S; ++s ) {
+      slot_indices_[s] = size<E>();
+    } // end of s-loop
+
+    size_t counts[B] { };
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      ++counts[bucket( hashes_[i] )];
+    } // end of i-loop
+
+    // Place large buckets first, while most slots are still empty
+    for ( size_t count = size<E>(); count > 0; --count ) {
+      for ( size_t b = 0; b < B; ++b ) {
+        if ( counts[b] != count ) continue;
+        auto displacement = std::uint32_t { };
+        while ( !place( b, displacement ) ) ++displacement;
+        displacements_[b] = displacement;
+      } // end of b-loop
+    } // end of count-loop
+  }
+
+  constexpr std::uint32_t hash( size_t i ) const{
+    return hashes_[i];
+  }
+
+  /// Index of the enumerator whose name hashes to hash or size<E>()
+  constexpr size_t find( std::uint32_t hash ) const{
+    auto s = slot( hash, displacements_[bucket( hash )] );
+    return slot_hashes_[s] == hash ? slot_indices_[s] : size<E>();
+  }
+};
+
+template<typename E>
+constexpr name_hash_table<E> name_hash_table_v{};
+
+} // namespace detail
+
+/// Name hash interface. The 32 bit FNV-1a hash of the name without its
+/// null-terminator, which does not depend on the enumerator's position.
+template<typename E> constexpr
+std::uint32_t name_hash( E const & e ){
+  return detail::name_hash_table_v<E>.hash( static_cast<size_t>( e ) );
+}
+
+template<typename E> constexpr
+bool try_from_name_hash( std::uint32_t hash,
+                         E & e ){
+  auto index = detail::name_hash_table_v<E>.find( hash );
+  if ( index == size<E>() ) return false;
+  e = static_cast<E>( index );
+  return true;
+}
+
+template<typename E> constexpr
+E from_name_hash( std::uint32_t hash ){
+  auto e = E { };
+  return try_from_name_hash( hash, e ) ? e :
+         throw std::invalid_argument( "Unknown enumerator name hash" );
+}
+
+namespace detail {
+
+/// Number of bytes from the first name to the end of the last name, which
+/// all lie in one buffer in order
+template<typename E> constexpr
+size_t name_span( ){
+  return static_cast<size_t>( names<E>()[size<E>() - 1] - names<E>()[0] ) +
+         string_length( names<E>()[size<E>() - 1] ) + 1;
+}
+
+/// Index of the enumerator whose name starts at each byte offset from the
+/// first name, or size<E>() for offsets within or between names
+template<typename E>
+class name_offset_table {
+  small_index_t<size<E>()> indices_[name_span<E>()] { };
+
+public:
+  constexpr name_offset_table( ){
+    for ( size_t i = 0; i < name_span<E>(); ++i ) {
+      indices_[i] = size<E>();
+    } // end of i-loop
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      indices_[names<E>()[i] - names<E>()[0]] = i;
+    } // end of i-loop
+  }
+
+  constexpr size_t operator[]( size_t offset ) const{
+    return offset < name_span<E>() ? indices_[offset] : size<E>();
+  }
+};
+
+template<typename E>
+constexpr name_offset_table<E> name_offset_table_v{};
+
+template<typename E>
+size_t name_pointer_index( char const * name ){
+  auto offset = reinterpret_cast<std::uintptr_t>( name ) -
+                reinterpret_cast<std::uintptr_t>( names<E>()[0] );
+  return name_offset_table_v<E>[static_cast<size_t>( offset )];
+}
+
+} // namespace detail
+
+/// Name pointer interface. Pointers returned by name() and names<E>() are
+/// mapped back to enumerators by their address in constant time; any other
+/// pointer, even to an equal string, is rejected.
+template<typename E>
+bool try_from_name_pointer( char const * name,
+                            E & e ){
+  auto index = detail::name_pointer_index<E>( name );
+  if ( index == size<E>() ) return false;
+  e = static_cast<E>( index );
+  return true;
+}
+
+template<typename E>
+E from_name_pointer( char const * name ){
+  auto e = E { };
+  if ( !try_from_name_pointer( name, e ) ) throw std::invalid_argument( "Not a name pointer" );
+  return e;
+}
+
+template<typename E>
+bool is_name_pointer( char const * name ){
+  return detail::name_pointer_index<E>( name ) != size<E>();
+}
+
+/// Compares two names, by identity if both are name pointers of E
+template<typename E>
+bool name_equal( char const * lhs,
+                 char const * rhs ){
+  if ( lhs == rhs ) return true;
+  if ( is_name_pointer<E>( lhs ) && is_name_pointer<E>( rhs ) ) return false;
+  auto length = detail::string_length( lhs );
+  return detail::string_length( rhs ) == length && detail::equal( lhs, rhs, length );
+}
+
+namespace detail {
+
+/// Index in To of the enumerator named like each enumerator of From, or
+/// size<To>() if To has no such name or alias. A last entry catches codes
+/// that do not denote an enumerator of From.
+template<typename From, typename To>
+class remap_table {
+  size_t indices_[size<From>() + 1] { };
+
+public:
+  constexpr remap_table( ){
+    for ( size_t i = 0; i < size<From>(); ++i ) {
+      auto string = names<From>()[i];
+      indices_[i] = parse_table_v<To>.find( string, string_length( string ) );
+    } // end of i-loop
+    indices_[size<From>()] = size<To>();
+  }
+
+  constexpr size_t operator[]( size_t i ) const{
+    return indices_[i < size<From>() ? i : size<From>()];
+  }
+
+  constexpr bool complete( ) const{
+    for ( size_t i = 0; i < size<From>(); ++i ) {
+      if ( indices_[i] == size<To>() ) return false;
+    } // end of i-loop
+    return true;
+  }
+};
+
+template<typename From, typename To>
+constexpr remap_table<From, To> remap_table_v{};
+
+} // namespace detail
+
+/// Remap interface, translating enumerators between two enums by name, e.g.
+/// between two versions of an enum. Names of To's aliases match as well.
+template<typename From, typename To> constexpr
+bool remaps_all( ){
+  return detail::remap_table_v<From, To>.complete( );
+}
+
+template<typename To, typename From> constexpr
+bool try_remap( From const & from,
+                To & to ){
+  auto index = detail::remap_table_v<From, To>[detail::unsigned_index( from )];
+  if ( index == size<To>() ) return false;
+  to = static_cast<To>( index );
+  return true;
+}
+
+template<typename To, typename From> constexpr
+To remap( From const & from ){
+  auto to = To { };
+  return try_remap( from, to ) ? to :
+         throw std::invalid_argument( "Enumerator has no counterpart" );
+}
+
+template<typename To, typename From> constexpr
+To remap_or( From const & from,
+             To fallback ){
+  auto to = To { };
+  return try_remap( from, to ) ? to : fallback;
+}
+
+/// Translates count codes of From to codes of To. Codes without counterpart,
+/// including those not denoting an enumerator of From, become fallback. The
+/// loop is a branchless gather from a table of size<From>() + 1 entries.
+template<typename From, typename To>
+void remap_codes( underlying_t<From> const * codes,
+                  size_t count,
+                  underlying_t<To> * result,
+                  To fallback ){
+  using unsigned_t=std::make_unsigned_t<underlying_t<From>>;
+
+  underlying_t<To> table[size<From>() + 1] { };
+  for ( size_t i = 0; i <= size<From>(); ++i ) {
+    auto index = detail::remap_table_v<From, To>[i];
+    table[i] = index == size<To>() ? static_cast<underlying_t<To>>( fallback ) :
+                                     static_cast<underlying_t<To>>( index );
+  } // end of i-loop
+
+  for ( size_t i = 0; i < count; ++i ) {
+    auto code = static_cast<unsigned_t>( codes[i] );
+    result[i] = table[code < size<From>() ? code : size<From>()];
+  } // end of i-loop
+}
+
+namespace detail {
+
+/// Matrix of the transitions declared by MAKE_NAMED_ENUM_TRANSITIONS, where
+/// entry from * size<E>() + to tells whether from may change to to
+template<typename E>
+class transition_table {
+  bool allowed_[size<E>() * size<E>()] { };
+  bool resolved_ { true };
+
+public:
+  constexpr transition_table( ){
+    for ( size_t i = 0; i < enum_transition_traits<E>::size; ++i ) {
+      auto from = enum_transition_traits<E>::strings()[2 * i];
+      auto to = enum_transition_traits<E>::strings()[2 * i + 1];
+      auto from_index = parse_table_v<E>.find( from, string_length( from ) );
+      auto to_index = parse_table_v<E>.find( to, string_length( to ) );
+      if ( from_index == size<E>() || to_index == size<E>() ) resolved_ = false;
+      else allowed_[from_index * size<E>() + to_index] = true;
+    } // end of i-loop
+  }
+
+  constexpr bool operator()( size_t from,
+                             size_t to ) const{
+    return allowed_[from * size<E>() + to];
+  }
+
+  /// True if all transitions name existing enumerators
+  constexpr bool consistent( ) const{
+    return resolved_;
+  }
+};
+
+template<typename E>
+constexpr transition_table<E> transition_table_v{};
+
+} // namespace detail
+
+/// True if from may change to to, e.g. in an atomic_enum
+template<typename E> constexpr
+bool transition_allowed( E const & from,
+                         E const & to ){
+  return detail::transition_table_v<E>( static_cast<size_t>( from ), static_cast<size_t>( to ) );
+}
+
 } // namespace named_enum
 
+/// The names are kept in a static member of a class template, which has one
+/// definition per program, so that name pointers are equal in all translation
+/// units. Hence an enum name must be unique per program: two translation units
+/// defining enums of the same name with other enumerators violate the one
+/// definition rule and may see each other's names.
 #define _MAKE_NAMED_ENUM_WITH_TYPE_IMPL(enum_name,enum_strictness,enum_type,...)       \
                                                                                        \
 static_assert(!named_enum::detail::empty(#__VA_ARGS__),"No enumerators provided");     \
@@ -117,26 +1105,106 @@ enum enum_strictness enum_name : enum_type {
                                                                                        \
 namespace named_enum {                                                                 \
                                                                                        \
+constexpr auto _##enum_name##_##size=detail::count_character(#__VA_ARGS__,',')+1;      \
+                                                                                       \
 template<>                                                                             \
 constexpr size_t size<enum_name>( ){                                                   \
-  return detail::count_character(#__VA_ARGS__,',')+1;                                  \
+  return _##enum_name##_##size;                                                        \
 }                                                                                      \
                                                                                        \
 template<>                                                                             \
+struct is_named_enum<enum_name> : std::true_type { };                                  \
+                                                                                       \
+template<>                                                                             \
 struct enum_name_traits<enum_name>{                                                    \
   using string_array_t=std::array<string_t, size<enum_name>()>;                        \
 };                                                                                     \
                                                                                        \
-constexpr auto _##enum_name##_##tokenizer=                                             \
-  detail::tokenizer<detail::length(#__VA_ARGS__),size<enum_name>()>(#__VA_ARGS__);     \
+template<typename>                                                                     \
+struct _##enum_name##_##names {                                                        \
+  using tokenizer_t=detail::tokenizer<detail::length(#__VA_ARGS__),size<enum_name>()>; \
+  static constexpr tokenizer_t tokenizer=tokenizer_t( #__VA_ARGS__ );                  \
+};                                                                                     \
+                                                                                       \
+template<typename T>                                                                   \
+constexpr typename _##enum_name##_##names<T>::tokenizer_t                              \
+  _##enum_name##_##names<T>::tokenizer;                                                \
                                                                                        \
 template<> constexpr                                                                   \
 const typename enum_name_traits<enum_name>::string_array_t & names<enum_name>( ){      \
-  return _##enum_name##_##tokenizer.strings();                                         \
+  return _##enum_name##_##names<void>::tokenizer.strings();                            \
 }                                                                                      \
                                                                                        \
 } // namespace named_enum
 
+#define MAKE_NAMED_ENUM_ALIASES(enum_name,...)                                         \
+                                                                                       \
+static_assert(!named_enum::detail::empty(#__VA_ARGS__),"No aliases provided");         \
+static_assert(named_enum::detail::count_character(#__VA_ARGS__,'=')==                  \
+              named_enum::detail::count_separated(#__VA_ARGS__,','),                   \
+  "Aliases must be given as alias = enumerator");                                      \
+                                                                                       \
+namespace named_enum {                                                                 \
+                                                                                       \
+template<typename>                                                                     \
+struct _##enum_name##_##aliases {                                                      \
+  using tokenizer_t=detail::tokenizer<detail::length(#__VA_ARGS__),                    \
+                                     2*detail::count_separated(#__VA_ARGS__,',')>;     \
+  static constexpr tokenizer_t tokenizer=tokenizer_t( #__VA_ARGS__ );                  \
+};                                                                                     \
+                                                                                       \
+template<typename T>                                                                   \
+constexpr typename _##enum_name##_##aliases<T>::tokenizer_t                            \
+  _##enum_name##_##aliases<T>::tokenizer;                                              \
+                                                                                       \
+template<>                                                                             \
+struct enum_alias_traits<enum_name>{                                                   \
+  static constexpr size_t size=detail::count_separated(#__VA_ARGS__,',');              \
+                                                                                       \
+  static constexpr string_t const * strings( ){                                        \
+    return &_##enum_name##_##aliases<void>::tokenizer.strings()[0];                    \
+  }                                                                                    \
+};                                                                                     \
+                                                                                       \
+static_assert(detail::parse_table_v<enum_name>.consistent(),                           \
+  "Aliases must name existing enumerators and must not repeat a spelling");            \
+                                                                                       \
+} // namespace named_enum
+
+#define MAKE_NAMED_ENUM_TRANSITIONS(enum_name,...)                                     \
+                                                                                       \
+static_assert(!named_enum::detail::empty(#__VA_ARGS__),"No transitions provided");     \
+static_assert(named_enum::detail::count_character(#__VA_ARGS__,'>')==                  \
+              named_enum::detail::count_separated(#__VA_ARGS__,','),                   \
+  "Transitions must be given as from -> to");                                          \
+                                                                                       \
+namespace named_enum {                                                                 \
+                                                                                       \
+template<typename>                                                                     \
+struct _##enum_name##_##transitions {                                                  \
+  using tokenizer_t=detail::tokenizer<detail::length(#__VA_ARGS__),                    \
+                                     2*detail::count_separated(#__VA_ARGS__,',')>;     \
+  static constexpr tokenizer_t tokenizer=tokenizer_t( #__VA_ARGS__ );                  \
+};                                                                                     \
+                                                                                       \
+template<typename T>                                                                   \
+constexpr typename _##enum_name##_##transitions<T>::tokenizer_t                        \
+  _##enum_name##_##transitions<T>::tokenizer;                                          \
+                                                                                       \
+template<>                                                                             \
+struct enum_transition_traits<enum_name>{                                              \
+  static constexpr size_t size=detail::count_separated(#__VA_ARGS__,',');              \
+                                                                                       \
+  static constexpr string_t const * strings( ){                                        \
+    return &_##enum_name##_##transitions<void>::tokenizer.strings()[0];                \
+  }                                                                                    \
+};                                                                                     \
+                                                                                       \
+static_assert(detail::transition_table_v<enum_name>.consistent(),                      \
+  "Transitions must name existing enumerators");                                       \
+                                                                                       \
+} // namespace named_enum
+
 #define MAKE_NAMED_ENUM(enum_name,...)                                                 \
     _MAKE_NAMED_ENUM_WITH_TYPE_IMPL(enum_name,,int,__VA_ARGS__)
 
@@ -148,3 +1216,5 @@ const typename enum_name_traits<enum_name>::string_array_t & names<enum_name>( )
 
 #define MAKE_NAMED_ENUM_CLASS_WITH_TYPE(enum_name,enum_type,...)                       \
     _MAKE_NAMED_ENUM_WITH_TYPE_IMPL(enum_name,class,enum_type,__VA_ARGS__)
+
+#endif // NAMED_ENUM_HPP
@@ -0,0 +1,91 @@
+#ifndef NAMED_ENUM_ATOMIC_HPP
+#define NAMED_ENUM_ATOMIC_HPP
+
+#include "named_enum.hpp"
+
+#include <atomic>
+
+namespace named_enum {
+
+/// Atomic enumerator whose changes are checked against the transitions
+/// declared with MAKE_NAMED_ENUM_TRANSITIONS. Transitions known at compile
+/// time are checked by the compiler and cost a single compare-and-swap.
+/// Unless NDEBUG is defined, successful transitions are passed by name to
+/// the tracer set for E.
+template<typename E>
+class atomic_enum {
+public:
+  using tracer_t=void (*)( string_t from, string_t to );
+
+private:
+  std::atomic<E> value_;
+
+  static std::atomic<tracer_t> & tracer( ){
+    static std::atomic<tracer_t> tracer { nullptr };
+    return tracer;
+  }
+
+  bool exchange( E & expected,
+                 E desired,
+                 std::memory_order order ){
+    auto from = expected;
+    if ( !value_.compare_exchange_strong( expected, desired, order ) ) return false;
+#ifndef NDEBUG
+    auto trace = tracer( ).load( std::memory_order_relaxed );
+    if ( trace ) trace( name( from ), name( desired ) );
+#else
+    static_cast<void>( from );
+#endif
+    return true;
+  }
+
+public:
+  explicit atomic_enum( E const & initial ) :
+          value_( initial ){
+  }
+
+  atomic_enum( atomic_enum const & ) = delete;
+  atomic_enum & operator=( atomic_enum const & ) = delete;
+
+  /// Sets the tracer of all atomic_enum<E>, nullptr disables tracing. May be
+  /// called while other threads change values.
+  static void set_tracer( tracer_t tracer_function ){
+    tracer( ).store( tracer_function, std::memory_order_relaxed );
+  }
+
+  E load( std::memory_order order=std::memory_order_seq_cst ) const{
+    return value_.load( order );
+  }
+
+  /// Changes From to To, false if the value was not From
+  template<E From, E To>
+  bool transition( std::memory_order order=std::memory_order_seq_cst ){
+    static_assert( transition_allowed( From, To ), "Transition is not allowed" );
+    auto expected = From;
+    return exchange( expected, To, order );
+  }
+
+  /// Changes expected to desired. Returns false, with expected updated to the
+  /// current value, if the value was not expected or the transition is not
+  /// allowed; a retry loop stops once transition_allowed( expected, desired )
+  /// is false.
+  bool try_transition( E & expected,
+                       E desired,
+                       std::memory_order order=std::memory_order_seq_cst ){
+    if ( !transition_allowed( expected, desired ) ) {
+      expected = value_.load( std::memory_order_acquire );
+      return false;
+    }
+    return exchange( expected, desired, order );
+  }
+
+  /// Sets the value without checking the transition, e.g. to reinitialize
+  void reset( E const & value,
+              std::memory_order order=std::memory_order_seq_cst ){
+    value_.store( value, order );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_ATOMIC_HPP
@@ -0,0 +1,217 @@
+#ifndef NAMED_ENUM_COLUMN_HPP
+#define NAMED_ENUM_COLUMN_HPP
+
+#include "named_enum.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+/// Binary column format for named enums. All fields are little-endian:
+///
+///   offset  size  field
+///        0     4  magic "NEC1"
+///        4     4  bits per code
+///        8     8  fingerprint of the enum
+///       16     8  number of codes
+///       24     4  number of names
+///       28     4  bytes of the name table
+///       32     -  null-terminated names, zero-padded to a multiple of 8 bytes
+///        -     -  codes packed into 64 bit words, lowest bits first, with as
+///                 many codes per word as fit without straddling two words
+namespace named_enum {
+namespace detail {
+
+constexpr char column_magic[4] = { 'N', 'E', 'C', '1' };
+constexpr size_t column_header_size = 32;
+
+constexpr unsigned bits_for( size_t size ){
+  auto bits = 1u;
+  while ( bits < 32 && ( size_t { 1 } << bits ) < size ) ++bits;
+  return bits;
+}
+
+constexpr size_t padded( size_t bytes ){
+  return ( bytes + 7 ) / 8 * 8;
+}
+
+inline void write_le( std::ostream & stream,
+                      std::uint64_t value,
+                      size_t bytes ){
+  char buffer[8] { };
+  for ( size_t i = 0; i < bytes; ++i ) {
+    buffer[i] = static_cast<char>( ( value >> ( 8 * i ) ) & 0xff );
+  } // end of i-loop
+  stream.write( buffer, static_cast<std::streamsize>( bytes ) );
+}
+
+inline std::uint64_t read_le( unsigned char const * data,
+                              size_t bytes ){
+  auto value = std::uint64_t { };
+  for ( size_t i = 0; i < bytes; ++i ) {
+    value |= std::uint64_t { data[i] } << ( 8 * i );
+  } // end of i-loop
+  return value;
+}
+
+} // namespace detail
+
+/// Writes a column of enumerators to a seekable stream as they arrive. The
+/// number of codes in the header is patched by finish() or the destructor.
+template<typename E>
+class column_writer {
+  static constexpr unsigned bits_=detail::bits_for( named_enum::size<E>() );
+  static constexpr unsigned per_word_=64 / bits_;
+
+  std::ostream & stream_;
+  std::ostream::pos_type start_;
+  std::uint64_t count_ { };
+  std::uint64_t word_ { };
+  bool finished_ { };
+
+public:
+  explicit column_writer( std::ostream & stream ) :
+          stream_( stream ), start_( stream.tellp( ) ){
+    auto bytes = size_t { };
+    for ( auto const & name : names<E>( ) ) {
+      bytes += detail::string_length( name ) + 1;
+    }
+
+    stream_.write( detail::column_magic, 4 );
+    detail::write_le( stream_, bits_, 4 );
+    detail::write_le( stream_, fingerprint<E>( ), 8 );
+    detail::write_le( stream_, 0, 8 );
+    detail::write_le( stream_, named_enum::size<E>( ), 4 );
+    detail::write_le( stream_, bytes, 4 );
+    for ( auto const & name : names<E>( ) ) {
+      stream_.write( name, static_cast<std::streamsize>( detail::string_length( name ) + 1 ) );
+    }
+    detail::write_le( stream_, 0, detail::padded( bytes ) - bytes );
+  }
+
+  column_writer( column_writer const & ) = delete;
+  column_writer & operator=( column_writer const & ) = delete;
+
+  ~column_writer( ){
+    if ( !finished_ ) finish( );
+  }
+
+  void append( E const & e ){
+    word_ |= std::uint64_t( static_cast<size_t>( e ) ) << ( count_ % per_word_ * bits_ );
+    if ( ++count_ % per_word_ == 0 ) {
+      detail::write_le( stream_, word_, 8 );
+      word_ = 0;
+    }
+  }
+
+  void append( E const * values,
+               size_t count ){
+    for ( size_t i = 0; i < count; ++i ) {
+      append( values[i] );
+    } // end of i-loop
+  }
+
+  /// Writes the last partial word and the number of codes
+  void finish( ){
+    finished_ = true;
+    if ( count_ % per_word_ != 0 ) detail::write_le( stream_, word_, 8 );
+    auto end = stream_.tellp( );
+    stream_.seekp( start_ + std::streamoff( 16 ) );
+    detail::write_le( stream_, count_, 8 );
+    stream_.seekp( end );
+  }
+
+  std::uint64_t size( ) const{
+    return count_;
+  }
+};
+
+/// Read-only view of a column written by column_writer, e.g. in a memory
+/// mapped file. Codes are decoded in place and names come from the table
+/// embedded in the data, so they are available even for columns written by
+/// another version of the enum. Throws std::invalid_argument for data that
+/// is not a well-formed column.
+template<typename E>
+class column_view {
+  unsigned char const * words_ { };
+  std::uint64_t count_ { };
+  std::uint64_t fingerprint_ { };
+  unsigned bits_ { };
+  unsigned per_word_ { };
+  std::vector<string_t> names_;
+
+public:
+  column_view( void const * data,
+               size_t bytes ){
+    auto begin = static_cast<unsigned char const *>( data );
+    if ( bytes < detail::column_header_size ) throw std::invalid_argument( "Column header is truncated" );
+    for ( size_t i = 0; i < 4; ++i ) {
+      if ( begin[i] != static_cast<unsigned char>( detail::column_magic[i] ) ) {
+        throw std::invalid_argument( "Data is no enum column" );
+      }
+    } // end of i-loop
+
+    bits_ = static_cast<unsigned>( detail::read_le( begin + 4, 4 ) );
+    fingerprint_ = detail::read_le( begin + 8, 8 );
+    count_ = detail::read_le( begin + 16, 8 );
+    auto size = detail::read_le( begin + 24, 4 );
+    auto table = detail::read_le( begin + 28, 4 );
+    if ( bits_ == 0 || bits_ > 32 ) throw std::invalid_argument( "Invalid code width" );
+    per_word_ = 64 / bits_;
+
+    auto words = detail::column_header_size + detail::padded( table );
+    if ( words > bytes ) throw std::invalid_argument( "Name table is truncated" );
+    if ( ( bytes - words ) / 8 < count_ / per_word_ + ( count_ % per_word_ != 0 ) ) {
+      throw std::invalid_argument( "Codes are truncated" );
+    }
+
+    auto names = reinterpret_cast<char const *>( begin + detail::column_header_size );
+    for ( size_t offset = 0; offset < table; ) {
+      names_.push_back( names + offset );
+      while ( offset < table && names[offset] != '\0' ) ++offset;
+      if ( offset++ == table ) throw std::invalid_argument( "Name is not terminated" );
+    }
+    if ( names_.size( ) != size ) throw std::invalid_argument( "Name table is inconsistent" );
+    words_ = begin + words;
+  }
+
+  std::uint64_t size( ) const{
+    return count_;
+  }
+
+  std::uint64_t fingerprint( ) const{
+    return fingerprint_;
+  }
+
+  /// True if the column was written with the same enumerators as E
+  bool compatible( ) const{
+    return fingerprint_ == named_enum::fingerprint<E>( );
+  }
+
+  /// Names embedded in the column
+  std::vector<string_t> const & names( ) const{
+    return names_;
+  }
+
+  size_t code( std::uint64_t i ) const{
+    auto word = detail::read_le( words_ + i / per_word_ * 8, 8 );
+    auto mask = ( std::uint64_t { 1 } << bits_ ) - 1;
+    return static_cast<size_t>( ( word >> ( i % per_word_ * bits_ ) ) & mask );
+  }
+
+  /// Embedded name of the i-th code or NAMED_ENUM_INVALID_NAME
+  string_t name( std::uint64_t i ) const{
+    auto c = code( i );
+    return c < names_.size( ) ? names_[c] : NAMED_ENUM_INVALID_NAME;
+  }
+
+  /// The i-th enumerator, only meaningful for compatible columns
+  E operator[]( std::uint64_t i ) const{
+    return static_cast<E>( code( i ) );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_COLUMN_HPP
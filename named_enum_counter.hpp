@@ -0,0 +1,88 @@
+#ifndef NAMED_ENUM_COUNTER_HPP
+#define NAMED_ENUM_COUNTER_HPP
+
+#include "named_enum.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace named_enum {
+namespace detail {
+
+constexpr size_t cache_line_size = 64;
+
+/// Shard of the calling thread, assigned round robin on first use
+inline size_t thread_shard( ){
+  static std::atomic<size_t> next { };
+  thread_local auto shard = next.fetch_add( 1, std::memory_order_relaxed );
+  return shard;
+}
+
+} // namespace detail
+
+/// Counts events per enumerator from many threads. Each thread increments
+/// the counters of its own shard, and shards never share a cache line, so
+/// concurrent increments do not contend unless more threads than shards run.
+/// Reads merge all shards. Objects should have static storage duration or be
+/// allocated with the alignment of a cache line.
+template<typename E, size_t Shards=16>
+class enum_counter {
+  static_assert( Shards != 0, "At least one shard is required" );
+
+  struct alignas( detail::cache_line_size ) shard {
+    std::atomic<std::uint64_t> counts[size<E>()];
+  };
+
+  shard shards_[Shards] { };
+
+public:
+  using snapshot_t=std::array<std::uint64_t, size<E>()>;
+
+  void increment( E const & e,
+                  std::uint64_t count=1 ){
+    shards_[detail::thread_shard( ) % Shards].counts[static_cast<size_t>( e )]
+      .fetch_add( count, std::memory_order_relaxed );
+  }
+
+  std::uint64_t operator[]( E const & e ) const{
+    auto sum = std::uint64_t { };
+    for ( auto const & shard : shards_ ) {
+      sum += shard.counts[static_cast<size_t>( e )].load( std::memory_order_relaxed );
+    }
+    return sum;
+  }
+
+  /// Counts of all enumerators, merged over the shards. Increments running
+  /// concurrently may or may not be included.
+  snapshot_t snapshot( ) const{
+    auto result = snapshot_t { };
+    for ( auto const & shard : shards_ ) {
+      for ( size_t i = 0; i < size<E>(); ++i ) {
+        result[i] += shard.counts[i].load( std::memory_order_relaxed );
+      } // end of i-loop
+    }
+    return result;
+  }
+
+  /// Calls f( name, count ) for every enumerator, e.g. to export the counts
+  template<typename F>
+  void for_each( F && f ) const{
+    auto counts = snapshot( );
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      f( names<E>()[i], counts[i] );
+    } // end of i-loop
+  }
+
+  void reset( ){
+    for ( auto & shard : shards_ ) {
+      for ( auto & count : shard.counts ) {
+        count.store( 0, std::memory_order_relaxed );
+      }
+    }
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_COUNTER_HPP
@@ -0,0 +1,275 @@
+#ifndef NAMED_ENUM_DYNAMIC_HPP
+#define NAMED_ENUM_DYNAMIC_HPP
+
+#include "named_enum.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace named_enum {
+namespace detail {
+
+constexpr std::uint32_t empty_slot = ~std::uint32_t { };
+
+} // namespace detail
+
+/// Enumeration whose names are registered at runtime, e.g. by plugins, with
+/// values numbered from zero in order of registration. Reads never lock or
+/// wait: they load the published size and the current block, which holds
+/// the names and an open addressing parse table at most half full.
+/// Registrations are serialized by a mutex and fill the block in place,
+/// where readers ignore values not yet published, and move to a block of
+/// twice the capacity when it is full. Replaced blocks are kept until the
+/// registry is destroyed, so names and views stay valid, and since
+/// capacities double they take less memory than the current block.
+class dynamic_enum {
+public:
+  using value_type=std::uint32_t;
+
+private:
+  struct entry {
+    string_t name;
+    size_t length;
+    std::uint32_t hash;
+  };
+
+  struct block {
+    explicit block( size_t capacity ) :
+            capacity( capacity ),
+            names( new string_t[capacity] ),
+            entries( new entry[capacity] ),
+            slots( new std::atomic<value_type>[2 * capacity] ){
+      for ( size_t i = 0; i < 2 * capacity; ++i ) {
+        slots[i].store( detail::empty_slot, std::memory_order_relaxed );
+      } // end of i-loop
+    }
+
+    size_t capacity;
+    std::unique_ptr<string_t[]> names; // contiguous for names_view
+    std::unique_ptr<entry[]> entries;
+    std::unique_ptr<std::atomic<value_type>[]> slots;
+  };
+
+  std::atomic<size_t> size_ { };
+  std::atomic<block const *> current_ { };
+  std::vector<std::unique_ptr<block>> blocks_;
+  std::vector<std::unique_ptr<char[]>> strings_;
+  std::mutex mutex_;
+
+  static size_t first_slot( block const & b,
+                            std::uint32_t hash ){
+    return detail::mix_32( hash ) & ( 2 * b.capacity - 1 );
+  }
+
+  static size_t next_slot( block const & b,
+                           size_t slot ){
+    return ( slot + 1 ) & ( 2 * b.capacity - 1 );
+  }
+
+  /// Value registered for the string among the first count values, or
+  /// detail::empty_slot
+  static value_type find( block const & b,
+                          size_t count,
+                          char const * string,
+                          size_t length ){
+    auto hash = detail::fnv1a_32( string, length );
+    for ( auto slot = first_slot( b, hash ); ; slot = next_slot( b, slot ) ) {
+      auto value = b.slots[slot].load( std::memory_order_acquire );
+      if ( value == detail::empty_slot ) return value;
+      if ( value >= count ) continue;
+      auto const & e = b.entries[value];
+      if ( e.hash == hash && e.length == length && std::memcmp( e.name, string, length ) == 0 ) return value;
+    }
+  }
+
+  /// Called by the writer, places a value whose entries are set
+  static void insert( block & b,
+                      value_type value ){
+    auto slot = first_slot( b, b.entries[value].hash );
+    while ( b.slots[slot].load( std::memory_order_relaxed ) != detail::empty_slot ) {
+      slot = next_slot( b, slot );
+    }
+    b.slots[slot].store( value, std::memory_order_release );
+  }
+
+  /// Called by the writer, moves count entries to a block of twice the
+  /// capacity and publishes it
+  block & grow( block const & old,
+                size_t count ){
+    blocks_.reserve( blocks_.size( ) + 1 );
+    std::unique_ptr<block> next( new block( 2 * old.capacity ) );
+    for ( size_t i = 0; i < count; ++i ) {
+      next->names[i] = old.names[i];
+      next->entries[i] = old.entries[i];
+      insert( *next, static_cast<value_type>( i ) );
+    } // end of i-loop
+    blocks_.push_back( std::move( next ) );
+    current_.store( blocks_.back( ).get( ), std::memory_order_release );
+    return *blocks_.back( );
+  }
+
+  /// Called by the writer, removes the entries of values from count on,
+  /// which were inserted last, restoring the table as it was before them
+  static void discard( block & b,
+                       size_t count,
+                       size_t end ){
+    for ( auto value = count; value < end; ++value ) {
+      auto slot = first_slot( b, b.entries[value].hash );
+      while ( b.slots[slot].load( std::memory_order_relaxed ) != value ) {
+        slot = next_slot( b, slot );
+      }
+      b.slots[slot].store( detail::empty_slot, std::memory_order_relaxed );
+    } // end of value-loop
+  }
+
+public:
+  /// Names registered when the view was taken, with the interface of the
+  /// std::array of names<E>()
+  class names_view {
+    string_t const * names_;
+    size_t size_;
+
+  public:
+    names_view( string_t const * names,
+                size_t size ) :
+            names_( names ), size_( size ){
+    }
+
+    size_t size( ) const{
+      return size_;
+    }
+
+    string_t operator[]( size_t i ) const{
+      return names_[i];
+    }
+
+    string_t const * begin( ) const{
+      return names_;
+    }
+
+    string_t const * end( ) const{
+      return names_ + size_;
+    }
+  };
+
+  dynamic_enum( ){
+    blocks_.emplace_back( new block( 8 ) );
+    current_.store( blocks_.back( ).get( ), std::memory_order_release );
+  }
+
+  dynamic_enum( dynamic_enum const & ) = delete;
+  dynamic_enum & operator=( dynamic_enum const & ) = delete;
+
+  /// Registers the names not registered yet and publishes them at once.
+  /// Names whose hashes collide are told apart by comparing them. Throws
+  /// std::invalid_argument for an empty name, in which case nothing is
+  /// registered.
+  template<typename Iterator>
+  void add( Iterator first,
+            Iterator last ){
+    std::lock_guard<std::mutex> lock( mutex_ );
+    auto const count = size_.load( std::memory_order_relaxed );
+    auto * b = blocks_.back( ).get( );
+    auto end = count;
+    std::vector<std::unique_ptr<char[]>> strings;
+    try {
+      for ( ; first != last; ++first ) {
+        string_t name = *first;
+        auto length = std::strlen( name );
+        if ( length == 0 ) throw std::invalid_argument( "Empty enumerator name" );
+        auto hash = detail::fnv1a_32( name, length );
+        auto registered = false;
+        for ( auto slot = first_slot( *b, hash ); ; slot = next_slot( *b, slot ) ) {
+          auto value = b->slots[slot].load( std::memory_order_relaxed );
+          if ( value == detail::empty_slot ) break;
+          auto const & e = b->entries[value];
+          if ( e.hash == hash && e.length == length && std::memcmp( e.name, name, length ) == 0 ) {
+            registered = true;
+            break;
+          }
+        }
+        if ( registered ) continue;
+
+        if ( end == b->capacity ) b = &grow( *b, end );
+        strings.emplace_back( new char[length + 1] );
+        std::memcpy( strings.back( ).get( ), name, length + 1 );
+        b->names[end] = strings.back( ).get( );
+        b->entries[end] = entry { strings.back( ).get( ), length, hash };
+        insert( *b, static_cast<value_type>( end++ ) );
+      }
+    }
+    catch ( ... ) {
+      discard( *b, count, end );
+      throw;
+    }
+    if ( end == count ) return;
+
+    strings_.reserve( strings_.size( ) + strings.size( ) );
+    for ( auto & string : strings ) {
+      strings_.push_back( std::move( string ) );
+    }
+    size_.store( end, std::memory_order_release );
+  }
+
+  void add( std::initializer_list<string_t> names ){
+    add( names.begin( ), names.end( ) );
+  }
+
+  /// Registers name unless it is registered and returns its value
+  value_type add( string_t name ){
+    add( &name, &name + 1 );
+    return from_string( name );
+  }
+
+  size_t size( ) const{
+    return size_.load( std::memory_order_acquire );
+  }
+
+  names_view names( ) const{
+    auto count = size_.load( std::memory_order_acquire );
+    return names_view( current_.load( std::memory_order_acquire )->names.get( ), count );
+  }
+
+  /// Name of value or NAMED_ENUM_INVALID_NAME if it is not registered
+  string_t name( value_type value ) const{
+    auto count = size_.load( std::memory_order_acquire );
+    if ( value >= count ) return NAMED_ENUM_INVALID_NAME;
+    return current_.load( std::memory_order_acquire )->names[value];
+  }
+
+  bool try_from_string( char const * string,
+                        size_t length,
+                        value_type & value ) const{
+    auto count = size_.load( std::memory_order_acquire );
+    auto found = find( *current_.load( std::memory_order_acquire ), count, string, length );
+    if ( found == detail::empty_slot ) return false;
+    value = found;
+    return true;
+  }
+
+  bool try_from_string( char const * string,
+                        value_type & value ) const{
+    return try_from_string( string, std::strlen( string ), value );
+  }
+
+  value_type from_string( char const * string,
+                          size_t length ) const{
+    auto value = value_type { };
+    if ( !try_from_string( string, length, value ) ) throw std::invalid_argument( "Unknown enumerator name" );
+    return value;
+  }
+
+  value_type from_string( char const * string ) const{
+    return from_string( string, std::strlen( string ) );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_DYNAMIC_HPP
@@ -0,0 +1,98 @@
+#ifndef NAMED_ENUM_FSM_HPP
+#define NAMED_ENUM_FSM_HPP
+
+#include "named_enum.hpp"
+
+#include <initializer_list>
+#include <stdexcept>
+
+namespace named_enum {
+
+/// Finite state machine table with states S and events E, flattened at
+/// compile time into size<S>() * size<E>() cells of next state and action.
+/// Cells without a rule keep the state and call the unhandled action, so a
+/// step is one indexed load and one indirect call without branches.
+template<typename S, typename E, typename Context>
+class fsm_table {
+public:
+  using action_t=void (*)( Context & );
+
+  struct rule {
+    S from;
+    E event;
+    S to;
+    action_t action;
+  };
+
+  static void ignore( Context & ){
+  }
+
+private:
+  struct cell {
+    S next;
+    action_t action;
+  };
+
+  cell cells_[size<S>() * size<E>()] { };
+  bool handled_[size<S>() * size<E>()] { };
+
+  static constexpr size_t index( S const & state,
+                                 E const & event ){
+    return static_cast<size_t>( state ) * size<E>() + static_cast<size_t>( event );
+  }
+
+public:
+  /// Rules with a null action only change the state. Two rules for the same
+  /// state and event are an error, a compile error for constexpr tables.
+  constexpr fsm_table( std::initializer_list<rule> rules,
+                       action_t unhandled=&ignore ){
+    for ( size_t s = 0; s < size<S>(); ++s ) {
+      for ( size_t e = 0; e < size<E>(); ++e ) {
+        cells_[s * size<E>() + e].next = static_cast<S>( s );
+        cells_[s * size<E>() + e].action = unhandled;
+      } // end of e-loop
+    } // end of s-loop
+
+    for ( auto const & r : rules ) {
+      auto i = index( r.from, r.event );
+      if ( handled_[i] ) throw std::logic_error( "Duplicate rule" );
+      handled_[i] = true;
+      cells_[i].next = r.to;
+      cells_[i].action = r.action ? r.action : &ignore;
+    }
+  }
+
+  constexpr bool handled( S const & state,
+                          E const & event ) const{
+    return handled_[index( state, event )];
+  }
+
+  constexpr S next( S const & state,
+                    E const & event ) const{
+    return cells_[index( state, event )].next;
+  }
+
+  /// Moves state along event and runs the cell's action
+  void step( S & state,
+             E const & event,
+             Context & context ) const{
+    auto const & c = cells_[index( state, event )];
+    state = c.next;
+    c.action( context );
+  }
+
+  /// Like step, additionally calling trace( from, event, to ) with the names
+  template<typename F>
+  void step( S & state,
+             E const & event,
+             Context & context,
+             F && trace ) const{
+    auto from = state;
+    step( state, event, context );
+    trace( name( from ), name( event ), name( state ) );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_FSM_HPP
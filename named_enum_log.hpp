@@ -0,0 +1,110 @@
+#ifndef NAMED_ENUM_LOG_HPP
+#define NAMED_ENUM_LOG_HPP
+
+#include "named_enum.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+namespace named_enum {
+
+/// Binary log record of an enumerator. The enum is identified by its
+/// fingerprint, so records can be decoded by another process or offline.
+struct log_record {
+  std::uint64_t type;
+  std::uint64_t code;
+  std::uint64_t stamp;
+};
+
+template<typename E> constexpr
+log_record make_record( E const & e,
+                        std::uint64_t stamp=0 ){
+  return log_record { fingerprint<E>( ), static_cast<std::uint64_t>( e ), stamp };
+}
+
+/// Lock-free ring of log records with one producer and one consumer, e.g.
+/// one ring per logging thread drained by a background thread. Capacity must
+/// be a power of two.
+template<size_t Capacity>
+class log_ring {
+  static_assert( Capacity != 0 && ( Capacity & ( Capacity - 1 ) ) == 0,
+                 "Capacity must be a power of two" );
+
+  alignas( 64 ) std::atomic<size_t> head_ { };
+  alignas( 64 ) std::atomic<size_t> tail_ { };
+  log_record records_[Capacity];
+
+public:
+  /// Called by the producer, false if the ring is full
+  bool try_push( log_record const & record ){
+    auto tail = tail_.load( std::memory_order_relaxed );
+    if ( tail - head_.load( std::memory_order_acquire ) == Capacity ) return false;
+    records_[tail & ( Capacity - 1 )] = record;
+    tail_.store( tail + 1, std::memory_order_release );
+    return true;
+  }
+
+  /// Called by the consumer, false if the ring is empty
+  bool try_pop( log_record & record ){
+    auto head = head_.load( std::memory_order_relaxed );
+    if ( head == tail_.load( std::memory_order_acquire ) ) return false;
+    record = records_[head & ( Capacity - 1 )];
+    head_.store( head + 1, std::memory_order_release );
+    return true;
+  }
+
+  /// Called by the consumer, passes all available records to f
+  template<typename F>
+  size_t drain( F && f ){
+    auto head = head_.load( std::memory_order_relaxed );
+    auto tail = tail_.load( std::memory_order_acquire );
+    for ( auto i = head; i != tail; ++i ) {
+      f( records_[i & ( Capacity - 1 )] );
+    } // end of i-loop
+    head_.store( tail, std::memory_order_release );
+    return tail - head;
+  }
+};
+
+/// Records e without formatting, false if the ring is full
+template<size_t Capacity, typename E>
+bool log_enum( log_ring<Capacity> & ring,
+               E const & e,
+               std::uint64_t stamp=0 ){
+  return ring.try_push( make_record( e, stamp ) );
+}
+
+/// Resolves the names of log records of all registered enums
+class log_decoder {
+  struct entry {
+    string_t const * names;
+    size_t size;
+  };
+  std::unordered_map<std::uint64_t, entry> entries_;
+
+public:
+  template<typename E>
+  log_decoder & add( ){
+    entries_[fingerprint<E>( )] = entry { &names<E>( )[0], size<E>( ) };
+    return *this;
+  }
+
+  bool knows( std::uint64_t type ) const{
+    return entries_.count( type ) != 0;
+  }
+
+  /// Name of the record's enumerator or NAMED_ENUM_INVALID_NAME if its enum
+  /// is not registered or its code is out of range
+  string_t name( log_record const & record ) const{
+    auto found = entries_.find( record.type );
+    if ( found == entries_.end( ) || record.code >= found->second.size ) {
+      return NAMED_ENUM_INVALID_NAME;
+    }
+    return found->second.names[record.code];
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_LOG_HPP
@@ -0,0 +1,122 @@
+#ifndef NAMED_ENUM_METRICS_HPP
+#define NAMED_ENUM_METRICS_HPP
+
+#include "named_enum_counter.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace named_enum {
+namespace detail {
+
+template<typename E> constexpr
+size_t label_bytes( ){
+  auto bytes = size_t { };
+  for ( size_t i = 0; i < size<E>(); ++i ) {
+    bytes += string_length( names<E>()[i] ) + 4;
+  } // end of i-loop
+  return bytes;
+}
+
+/// Label value fragments in the Prometheus text format, i.e. "NAME"} and a
+/// blank for every enumerator, concatenated in one buffer. Enumerator names
+/// are identifiers, so they never need escaping.
+template<typename E>
+class label_table {
+  char chars_[label_bytes<E>()] { };
+  size_t offsets_[size<E>() + 1] { };
+
+public:
+  constexpr label_table( ){
+    size_t offset = 0;
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      offsets_[i] = offset;
+      chars_[offset++] = '"';
+      for ( auto name = names<E>()[i]; *name != '\0'; ++name ) {
+        chars_[offset++] = *name;
+      }
+      chars_[offset++] = '"';
+      chars_[offset++] = '}';
+      chars_[offset++] = ' ';
+    } // end of i-loop
+    offsets_[size<E>()] = offset;
+  }
+
+  constexpr char const * fragment( size_t i ) const{
+    return &chars_[offsets_[i]];
+  }
+
+  constexpr size_t length( size_t i ) const{
+    return offsets_[i + 1] - offsets_[i];
+  }
+};
+
+template<typename E>
+constexpr label_table<E> label_table_v{};
+
+constexpr size_t max_decimal_digits = 20;
+
+inline size_t write_decimal( char * buffer,
+                             std::uint64_t value ){
+  char digits[max_decimal_digits];
+  size_t count = 0;
+  do {
+    digits[max_decimal_digits - ++count] = static_cast<char>( '0' + value % 10 );
+    value /= 10;
+  } while ( value != 0 );
+  std::memcpy( buffer, digits + max_decimal_digits - count, count );
+  return count;
+}
+
+} // namespace detail
+
+/// Number of bytes that always suffices for write_metric_family
+template<typename E>
+size_t metric_family_capacity( char const * family,
+                               char const * label ){
+  auto prefix = std::strlen( family ) + std::strlen( label ) + 2;
+  return size<E>( ) * ( prefix + detail::max_decimal_digits + 1 ) + detail::label_bytes<E>( );
+}
+
+/// Writes one line family{label="NAME"} count per enumerator in the Prometheus
+/// text format. Returns the number of bytes written, or 0 without writing
+/// anything if capacity is less than metric_family_capacity.
+template<typename E>
+size_t write_metric_family( char * buffer,
+                            size_t capacity,
+                            char const * family,
+                            char const * label,
+                            std::uint64_t const * counts ){
+  if ( capacity < metric_family_capacity<E>( family, label ) ) return 0;
+
+  auto family_length = std::strlen( family );
+  auto label_length = std::strlen( label );
+  auto begin = buffer;
+  for ( size_t i = 0; i < size<E>( ); ++i ) {
+    std::memcpy( buffer, family, family_length );
+    buffer += family_length;
+    *buffer++ = '{';
+    std::memcpy( buffer, label, label_length );
+    buffer += label_length;
+    *buffer++ = '=';
+    std::memcpy( buffer, detail::label_table_v<E>.fragment( i ), detail::label_table_v<E>.length( i ) );
+    buffer += detail::label_table_v<E>.length( i );
+    buffer += detail::write_decimal( buffer, counts[i] );
+    *buffer++ = '\n';
+  } // end of i-loop
+  return static_cast<size_t>( buffer - begin );
+}
+
+template<typename E, size_t Shards>
+size_t write_metric_family( char * buffer,
+                            size_t capacity,
+                            char const * family,
+                            char const * label,
+                            enum_counter<E, Shards> const & counter ){
+  auto counts = counter.snapshot( );
+  return write_metric_family<E>( buffer, capacity, family, label, counts.data( ) );
+}
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_METRICS_HPP
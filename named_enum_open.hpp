@@ -0,0 +1,187 @@
+#ifndef NAMED_ENUM_OPEN_HPP
+#define NAMED_ENUM_OPEN_HPP
+
+#include "named_enum.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace named_enum {
+namespace detail {
+
+/// Bounded set of strings for any number of threads without locks, using
+/// open addressing with linear probing. A slot is claimed by publishing a
+/// block holding the length and a copy of the string with a
+/// compare-and-swap. Slots are never released, so interned strings live as
+/// long as the table.
+template<size_t Capacity>
+class intern_table {
+  static_assert( Capacity != 0 && ( Capacity & ( Capacity - 1 ) ) == 0,
+                 "Capacity must be a power of two" );
+
+  std::atomic<char const *> blocks_[Capacity] { };
+
+  static size_t block_length( char const * block ){
+    size_t length;
+    std::memcpy( &length, block, sizeof( length ) );
+    return length;
+  }
+
+  static char const * block_string( char const * block ){
+    return block + sizeof( size_t );
+  }
+
+  static char * make_block( char const * string,
+                            size_t length ){
+    auto block = new char[sizeof( size_t ) + length + 1];
+    std::memcpy( block, &length, sizeof( length ) );
+    std::memcpy( block + sizeof( size_t ), string, length );
+    block[sizeof( size_t ) + length] = '\0';
+    return block;
+  }
+
+  static bool equal( char const * block,
+                     char const * string,
+                     size_t length ){
+    return block_length( block ) == length && std::memcmp( block_string( block ), string, length ) == 0;
+  }
+
+public:
+  intern_table( ) = default;
+  intern_table( intern_table const & ) = delete;
+  intern_table & operator=( intern_table const & ) = delete;
+
+  ~intern_table( ){
+    for ( auto & block : blocks_ ) {
+      delete[] block.load( std::memory_order_relaxed );
+    }
+  }
+
+  /// Slot of the string, interning it if needed, or Capacity if the table is
+  /// full. The string needs no null-terminator.
+  size_t intern( char const * string,
+                 size_t length ){
+    auto start = mix_32( fnv1a_32( string, length ) );
+    char * copy = nullptr;
+    for ( size_t i = 0; i < Capacity; ++i ) {
+      auto slot = ( start + i ) & ( Capacity - 1 );
+      auto block = blocks_[slot].load( std::memory_order_acquire );
+      if ( block == nullptr ) {
+        if ( copy == nullptr ) copy = make_block( string, length );
+        if ( blocks_[slot].compare_exchange_strong( block, copy, std::memory_order_acq_rel ) ) return slot;
+      }
+      if ( equal( block, string, length ) ) {
+        delete[] copy;
+        return slot;
+      }
+    } // end of i-loop
+    delete[] copy;
+    return Capacity;
+  }
+
+  /// Interned string of a slot returned by intern
+  char const * string( size_t slot ) const{
+    return block_string( blocks_[slot].load( std::memory_order_acquire ) );
+  }
+};
+
+} // namespace detail
+
+/// Enumerator of E or a name unknown to E, e.g. one sent by a newer peer.
+/// Known names are parsed like from_string<E>. Unknown names are interned
+/// once in a table shared by all open_enum<E, Capacity>, so equal names
+/// compare equal and copies never allocate.
+template<typename E, size_t Capacity=1024>
+class open_enum {
+  using table_t=detail::intern_table<Capacity>;
+
+  size_t index_; // enumerator index, or size<E>() plus the slot if unknown
+
+  static table_t & table( ){
+    static table_t table;
+    return table;
+  }
+
+  explicit open_enum( size_t index ) :
+          index_( index ){
+  }
+
+public:
+  open_enum( ) :
+          index_( 0 ){
+  }
+
+  open_enum( E const & e ) :
+          index_( static_cast<size_t>( e ) ){
+  }
+
+  /// False only if the name is unknown and the intern table is full
+  static bool try_from_string( char const * string,
+                               size_t length,
+                               open_enum & value ){
+    auto index = might_be_name<E>( string, length ) ? detail::parse_table_v<E>.find( string, length ) :
+                 named_enum::size<E>();
+    if ( index == named_enum::size<E>() ) {
+      auto slot = table( ).intern( string, length );
+      if ( slot == Capacity ) return false;
+      index += slot;
+    }
+    value = open_enum( index );
+    return true;
+  }
+
+  static bool try_from_string( char const * string,
+                               open_enum & value ){
+    return try_from_string( string, std::strlen( string ), value );
+  }
+
+  static open_enum from_string( char const * string,
+                                size_t length ){
+    auto value = open_enum { };
+    if ( !try_from_string( string, length, value ) ) throw std::length_error( "Intern table is full" );
+    return value;
+  }
+
+  static open_enum from_string( char const * string ){
+    return from_string( string, std::strlen( string ) );
+  }
+
+  bool known( ) const{
+    return index_ < named_enum::size<E>();
+  }
+
+  bool try_value( E & e ) const{
+    if ( !known( ) ) return false;
+    e = static_cast<E>( index_ );
+    return true;
+  }
+
+  E value( ) const{
+    if ( !known( ) ) throw std::out_of_range( "Unknown enumerator" );
+    return static_cast<E>( index_ );
+  }
+
+  string_t name( ) const{
+    return known( ) ? names<E>()[index_] : table( ).string( index_ - named_enum::size<E>() );
+  }
+
+  friend bool operator==( open_enum const & lhs,
+                          open_enum const & rhs ){
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=( open_enum const & lhs,
+                          open_enum const & rhs ){
+    return lhs.index_ != rhs.index_;
+  }
+};
+
+template<typename E, size_t Capacity>
+string_t name( open_enum<E, Capacity> const & e ){
+  return e.name( );
+}
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_OPEN_HPP
@@ -0,0 +1,135 @@
+#ifndef NAMED_ENUM_PRODUCT_HPP
+#define NAMED_ENUM_PRODUCT_HPP
+
+#include "named_enum.hpp"
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+namespace named_enum {
+
+/// Dense index of a tuple of enumerators of Es in row major order, i.e.
+/// the last enumeration varies fastest, in [0, size<E1>() * size<E2>() ...)
+template<typename... Es>
+struct product_key {
+  static_assert( sizeof...( Es ) != 0, "At least one enumeration is required" );
+
+  template<size_t I>
+  using element_t=typename std::tuple_element<I, std::tuple<Es...>>::type;
+
+  static constexpr size_t size( ){
+    size_t const sizes[] = { named_enum::size<Es>()... };
+    auto result = size_t { 1 };
+    for ( auto s : sizes ) {
+      result *= s;
+    }
+    return result;
+  }
+
+  /// Distance between indices differing by one in component I
+  static constexpr size_t stride( size_t component ){
+    size_t const sizes[] = { named_enum::size<Es>()... };
+    auto result = size_t { 1 };
+    for ( auto i = component + 1; i < sizeof...( Es ); ++i ) {
+      result *= sizes[i];
+    } // end of i-loop
+    return result;
+  }
+
+  static constexpr size_t index( Es const & ... es ){
+    size_t const sizes[] = { named_enum::size<Es>()... };
+    size_t const indices[] = { static_cast<size_t>( es )... };
+    auto result = size_t { };
+    for ( size_t i = 0; i < sizeof...( Es ); ++i ) {
+      result = result * sizes[i] + indices[i];
+    } // end of i-loop
+    return result;
+  }
+
+  template<size_t I>
+  static constexpr element_t<I> get( size_t index ){
+    return static_cast<element_t<I>>( index / stride( I ) % named_enum::size<element_t<I>>() );
+  }
+
+  static constexpr std::tuple<Es...> decode( size_t index ){
+    return decode( index, std::index_sequence_for<Es...>( ) );
+  }
+
+  static constexpr std::array<string_t, sizeof...( Es )> names( size_t index ){
+    return names( index, std::index_sequence_for<Es...>( ) );
+  }
+
+private:
+  template<size_t... Is>
+  static constexpr std::tuple<Es...> decode( size_t index,
+                                             std::index_sequence<Is...> ){
+    return std::tuple<Es...>( get<Is>( index )... );
+  }
+
+  template<size_t... Is>
+  static constexpr std::array<string_t, sizeof...( Es )> names( size_t index,
+                                                                std::index_sequence<Is...> ){
+    return std::array<string_t, sizeof...( Es )> { { name( get<Is>( index ) )... } };
+  }
+};
+
+/// Array with one T per tuple of enumerators of Es, so that a lookup is one
+/// multiply-add per enumeration and one load
+template<typename T, typename... Es>
+class product_array {
+public:
+  using key_t=product_key<Es...>;
+
+private:
+  std::array<T, key_t::size( )> values_ { };
+
+public:
+  T & operator()( Es const & ... es ){
+    return values_[key_t::index( es... )];
+  }
+
+  constexpr T const & operator()( Es const & ... es ) const{
+    return values_[key_t::index( es... )];
+  }
+
+  T & operator[]( size_t index ){
+    return values_[index];
+  }
+
+  constexpr T const & operator[]( size_t index ) const{
+    return values_[index];
+  }
+
+  static constexpr size_t size( ){
+    return key_t::size( );
+  }
+
+  T * data( ){
+    return values_.data( );
+  }
+
+  T const * data( ) const{
+    return values_.data( );
+  }
+
+  T * begin( ){
+    return values_.data( );
+  }
+
+  T * end( ){
+    return values_.data( ) + values_.size( );
+  }
+
+  T const * begin( ) const{
+    return values_.data( );
+  }
+
+  T const * end( ) const{
+    return values_.data( ) + values_.size( );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_PRODUCT_HPP
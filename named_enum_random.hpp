@@ -0,0 +1,169 @@
+#ifndef NAMED_ENUM_RANDOM_HPP
+#define NAMED_ENUM_RANDOM_HPP
+
+#include "named_enum.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace named_enum {
+
+/// Small and fast generator for simulations and load generation, not for
+/// cryptography. Satisfies UniformRandomBitGenerator.
+class xorshift64 {
+  std::uint64_t state_;
+
+public:
+  using result_type=std::uint64_t;
+
+  constexpr explicit xorshift64( std::uint64_t seed=0x9e3779b97f4a7c15u ) :
+          state_( seed != 0 ? seed : 0x9e3779b97f4a7c15u ){
+  }
+
+  static constexpr result_type min( ){
+    return 0;
+  }
+
+  static constexpr result_type max( ){
+    return std::numeric_limits<result_type>::max( );
+  }
+
+  /// xorshift64*, of which the high bits are the strongest
+  result_type operator()( ){
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return state_ * 0x2545f4914f6cdd1du;
+  }
+};
+
+namespace detail {
+
+/// 32 random bits from a generator of 32 or 64 bits, taking the high bits
+template<typename G>
+std::uint32_t random_32( G & g ){
+  static_assert( G::min( ) == 0 && ( G::max( ) == 0xffffffffu ||
+                                     G::max( ) == std::numeric_limits<std::uint64_t>::max( ) ),
+                 "The generator must produce 32 or 64 random bits" );
+  return static_cast<std::uint32_t>( G::max( ) == 0xffffffffu ? g( ) : g( ) >> 32 );
+}
+
+/// numerator * 2^32 / denominator rounded down, for numerator < denominator
+constexpr std::uint64_t fraction_32( std::uint64_t numerator,
+                                     std::uint64_t denominator ){
+  auto quotient = std::uint64_t { };
+  for ( int bit = 0; bit < 32; ++bit ) {
+    numerator <<= 1;
+    quotient <<= 1;
+    if ( numerator >= denominator ) {
+      numerator -= denominator;
+      quotient |= 1;
+    }
+  } // end of bit-loop
+  return quotient;
+}
+
+/// Uniform index below n without modulo bias by multiplying with a random
+/// 32 bit fraction and rejecting the few products that would favour some
+/// indices, after D. Lemire. Rejections are rare for small n.
+template<typename G>
+std::uint32_t uniform_index( G & g,
+                             std::uint32_t n ){
+  auto product = std::uint64_t { random_32( g ) } * n;
+  auto low = static_cast<std::uint32_t>( product );
+  if ( low < n ) {
+    auto threshold = static_cast<std::uint32_t>( -n ) % n;
+    while ( low < threshold ) {
+      product = std::uint64_t { random_32( g ) } * n;
+      low = static_cast<std::uint32_t>( product );
+    }
+  }
+  return static_cast<std::uint32_t>( product >> 32 );
+}
+
+} // namespace detail
+
+/// Random interface. Every enumerator is equally likely.
+template<typename E, typename G>
+E uniform_enum( G & g ){
+  return static_cast<E>( detail::uniform_index( g, static_cast<std::uint32_t>( size<E>() ) ) );
+}
+
+template<typename E, typename G>
+void fill_uniform( E * values,
+                   size_t count,
+                   G & g ){
+  for ( size_t i = 0; i < count; ++i ) {
+    values[i] = uniform_enum<E>( g );
+  } // end of i-loop
+}
+
+/// Enumerators drawn with probability proportional to integer weights using
+/// Vose's alias method: a draw picks a column uniformly, then either the
+/// column's enumerator or its alias by one comparison, so it costs the same
+/// for any weights. The table can be built at compile time.
+template<typename E>
+class weighted_sampler {
+  std::uint64_t thresholds_[size<E>()] { }; // 32 bit fractions, 2^32 for always
+  size_t aliases_[size<E>()] { };
+
+public:
+  /// Throws std::invalid_argument if all weights are zero
+  template<size_t N>
+  constexpr explicit weighted_sampler( std::uint32_t const (&weights)[N] ){
+    static_assert( N == size<E>(), "Every enumerator needs one weight" );
+    auto total = std::uint64_t { };
+    for ( size_t i = 0; i < N; ++i ) {
+      total += weights[i];
+    } // end of i-loop
+    if ( total == 0 ) throw std::invalid_argument( "All weights are zero" );
+
+    // Scaled weights n * w against total, so that a column holds exactly total
+    std::uint64_t scaled[size<E>()] { };
+    size_t small[size<E>()] { };
+    size_t large[size<E>()] { };
+    size_t small_count = 0;
+    size_t large_count = 0;
+    for ( size_t i = 0; i < N; ++i ) {
+      scaled[i] = std::uint64_t { weights[i] } * N;
+      aliases_[i] = i;
+      if ( scaled[i] < total ) small[small_count++] = i;
+      else large[large_count++] = i;
+    } // end of i-loop
+
+    while ( small_count != 0 && large_count != 0 ) {
+      auto s = small[--small_count];
+      auto l = large[large_count - 1];
+      thresholds_[s] = detail::fraction_32( scaled[s], total );
+      aliases_[s] = l;
+      scaled[l] -= total - scaled[s];
+      if ( scaled[l] < total ) {
+        --large_count;
+        small[small_count++] = l;
+      }
+    }
+    // Leftovers are full columns up to rounding
+    while ( large_count != 0 ) thresholds_[large[--large_count]] = std::uint64_t { 1 } << 32;
+    while ( small_count != 0 ) thresholds_[small[--small_count]] = std::uint64_t { 1 } << 32;
+  }
+
+  template<typename G>
+  E operator()( G & g ) const{
+    auto column = detail::uniform_index( g, static_cast<std::uint32_t>( size<E>() ) );
+    return static_cast<E>( detail::random_32( g ) < thresholds_[column] ? column : aliases_[column] );
+  }
+
+  template<typename G>
+  void fill( E * values,
+             size_t count,
+             G & g ) const{
+    for ( size_t i = 0; i < count; ++i ) {
+      values[i] = ( *this )( g );
+    } // end of i-loop
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_RANDOM_HPP
@@ -0,0 +1,181 @@
+#ifndef NAMED_ENUM_SCHEDULER_HPP
+#define NAMED_ENUM_SCHEDULER_HPP
+
+#include "named_enum.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace named_enum {
+namespace detail {
+
+/// Index of the lowest set bit, mask must not be zero
+inline unsigned lowest_bit( std::uint64_t mask ){
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward64( &index, mask );
+  return static_cast<unsigned>( index );
+#else
+  return static_cast<unsigned>( __builtin_ctzll( mask ) );
+#endif
+}
+
+/// Bounded lock-free queue for many producers and one consumer. Each cell
+/// carries a sequence number telling producers and the consumer whose turn
+/// it is, after D. Vyukov's bounded queue.
+template<typename T, size_t Capacity>
+class mpsc_queue {
+  static_assert( Capacity != 0 && ( Capacity & ( Capacity - 1 ) ) == 0,
+                 "Capacity must be a power of two" );
+
+  struct cell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  alignas( 64 ) std::atomic<size_t> tail_ { };
+  alignas( 64 ) size_t head_ { };
+  cell cells_[Capacity];
+
+public:
+  mpsc_queue( ){
+    for ( size_t i = 0; i < Capacity; ++i ) {
+      cells_[i].sequence.store( i, std::memory_order_relaxed );
+    } // end of i-loop
+  }
+
+  mpsc_queue( mpsc_queue const & ) = delete;
+  mpsc_queue & operator=( mpsc_queue const & ) = delete;
+
+  /// Called by any producer, false if the queue is full
+  template<typename U>
+  bool try_push( U && value ){
+    auto position = tail_.load( std::memory_order_relaxed );
+    for ( ; ; ) {
+      auto & cell = cells_[position & ( Capacity - 1 )];
+      auto sequence = cell.sequence.load( std::memory_order_acquire );
+      if ( sequence == position ) {
+        if ( tail_.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+          cell.value = std::forward<U>( value );
+          cell.sequence.store( position + 1, std::memory_order_release );
+          return true;
+        }
+      }
+      else if ( sequence < position ) {
+        return false;
+      }
+      else {
+        position = tail_.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+  /// Called by the consumer, false if the queue is empty
+  bool try_pop( T & value ){
+    auto & cell = cells_[head_ & ( Capacity - 1 )];
+    if ( cell.sequence.load( std::memory_order_acquire ) != head_ + 1 ) return false;
+    value = std::move( cell.value );
+    cell.sequence.store( head_ + Capacity, std::memory_order_release );
+    ++head_;
+    return true;
+  }
+
+  /// Called by the consumer
+  bool empty( ) const{
+    auto const & cell = cells_[head_ & ( Capacity - 1 )];
+    return cell.sequence.load( std::memory_order_acquire ) != head_ + 1;
+  }
+};
+
+} // namespace detail
+
+/// Counters of one class of an enum_scheduler
+struct scheduler_stats {
+  std::uint64_t pushed;
+  std::uint64_t popped;
+  std::uint64_t rejected;
+};
+
+/// Work queues keyed by the enumerators of E, where earlier enumerators have
+/// higher priority. Any thread may push, one thread pops. A bit per class
+/// marks non-empty queues, so the highest priority work is found by one
+/// count-trailing-zeros instruction regardless of the number of classes.
+template<typename E, typename T, size_t Capacity=1024>
+class enum_scheduler {
+  static_assert( size<E>() <= 64, "At most 64 classes are supported" );
+
+  struct alignas( 64 ) lane {
+    detail::mpsc_queue<T, Capacity> queue;
+    std::atomic<std::uint64_t> pushed { };
+    std::atomic<std::uint64_t> rejected { };
+    std::atomic<std::uint64_t> popped { }; // written by the consumer only
+  };
+
+  alignas( 64 ) std::atomic<std::uint64_t> ready_ { };
+  lane lanes_[size<E>()];
+
+  static constexpr std::uint64_t bit( size_t index ){
+    return std::uint64_t { 1 } << index;
+  }
+
+public:
+  /// Called by any producer, false if the queue of the class is full
+  template<typename U>
+  bool try_push( E const & e,
+                 U && value ){
+    auto index = static_cast<size_t>( e );
+    auto & lane = lanes_[index];
+    if ( !lane.queue.try_push( std::forward<U>( value ) ) ) {
+      lane.rejected.fetch_add( 1, std::memory_order_relaxed );
+      return false;
+    }
+    lane.pushed.fetch_add( 1, std::memory_order_relaxed );
+    ready_.fetch_or( bit( index ), std::memory_order_release );
+    return true;
+  }
+
+  /// Called by the consumer, pops from the highest priority non-empty class
+  bool try_pop( T & value,
+                E * e=nullptr ){
+    for ( auto ready = ready_.load( std::memory_order_acquire ); ready != 0;
+          ready = ready_.load( std::memory_order_acquire ) ) {
+      auto index = detail::lowest_bit( ready );
+      auto & lane = lanes_[index];
+      if ( lane.queue.try_pop( value ) ) {
+        lane.popped.store( lane.popped.load( std::memory_order_relaxed ) + 1,
+                           std::memory_order_relaxed );
+        if ( e ) *e = static_cast<E>( index );
+        return true;
+      }
+      // Clear the bit, then restore it if a producer raced with us
+      ready_.fetch_and( ~bit( index ), std::memory_order_acq_rel );
+      if ( !lane.queue.empty( ) ) ready_.fetch_or( bit( index ), std::memory_order_release );
+    }
+    return false;
+  }
+
+  /// Counters of a class, which may lag behind concurrent pushes and pops
+  scheduler_stats stats( E const & e ) const{
+    auto const & lane = lanes_[static_cast<size_t>( e )];
+    return scheduler_stats { lane.pushed.load( std::memory_order_relaxed ),
+                             lane.popped.load( std::memory_order_relaxed ),
+                             lane.rejected.load( std::memory_order_relaxed ) };
+  }
+
+  /// Calls f( name, stats ) for every class
+  template<typename F>
+  void for_each_stats( F && f ) const{
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      f( names<E>()[i], stats( static_cast<E>( i ) ) );
+    } // end of i-loop
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_SCHEDULER_HPP
@@ -0,0 +1,240 @@
+#ifndef NAMED_ENUM_SEARCH_HPP
+#define NAMED_ENUM_SEARCH_HPP
+
+#include "named_enum.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace named_enum {
+namespace detail {
+
+constexpr bool is_word_character( char c ){
+  return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' ) || c == '_';
+}
+
+/// Number of byte classes: one per character occurring in a name or alias,
+/// one for other word characters and one for word boundaries
+template<typename E> constexpr
+size_t search_class_count( ){
+  bool seen[256] { };
+  size_t count = 2;
+  for ( size_t i = 0; i < parse_table<E>::C; ++i ) {
+    auto string = parse_table_v<E>.string( i );
+    for ( size_t j = 0; j < parse_table_v<E>.length( i ); ++j ) {
+      auto c = static_cast<unsigned char>( string[j] );
+      if ( !seen[c] ) ++count;
+      seen[c] = true;
+    } // end of j-loop
+  } // end of i-loop
+  return count;
+}
+
+/// Upper bound of the number of trie nodes: the root plus one node per
+/// character of every name and alias enclosed by two boundaries
+template<typename E> constexpr
+size_t search_state_count( ){
+  size_t count = 1;
+  for ( size_t i = 0; i < parse_table<E>::C; ++i ) {
+    count += parse_table_v<E>.length( i ) + 2;
+  } // end of i-loop
+  return count;
+}
+
+/// Aho-Corasick automaton over the names and aliases of E, each enclosed by
+/// word boundaries, flattened into a deterministic transition table over
+/// byte classes. A state completing a pattern therefore sits right after a
+/// whole word match, and scanning costs one class and one transition lookup
+/// per byte, independently of the number of names.
+template<typename E>
+class search_automaton {
+public:
+  static constexpr size_t K=search_class_count<E>( );
+  static constexpr size_t S=search_state_count<E>( );
+  static constexpr size_t boundary=0;
+  static constexpr size_t other_word=1;
+
+  using state_t=small_index_t<S * K>;
+
+private:
+  std::uint8_t classes_[256] { };
+  state_t transitions_[S * K] { };
+  size_t outputs_[S] { }; // matched enumerator index of terminal states
+  size_t lengths_[S] { }; // length of the matched spelling
+  size_t start_ { };
+  size_t first_terminal_ { };
+
+  constexpr size_t add( size_t state,
+                        size_t c,
+                        size_t & count ){
+    if ( transitions_[state * K + c] == 0 ) {
+      transitions_[state * K + c] = static_cast<state_t>( count++ );
+    }
+    return transitions_[state * K + c];
+  }
+
+public:
+  constexpr search_automaton( ){
+    for ( size_t c = 0; c < 256; ++c ) {
+      classes_[c] = is_word_character( static_cast<char>( c ) ) ? other_word : boundary;
+    } // end of c-loop
+    auto next_class = size_t { 2 };
+    for ( size_t i = 0; i < parse_table<E>::C; ++i ) {
+      auto string = parse_table_v<E>.string( i );
+      for ( size_t j = 0; j < parse_table_v<E>.length( i ); ++j ) {
+        auto c = static_cast<unsigned char>( string[j] );
+        if ( classes_[c] == other_word ) classes_[c] = static_cast<std::uint8_t>( next_class++ );
+      } // end of j-loop
+    } // end of i-loop
+
+    // Trie, where transition 0 means none since no edge leads to the root.
+    // Terminal states have no children and are numbered down from S - 1, so
+    // that a match is detected by one comparison.
+    size_t count = 1;
+    size_t terminal = S;
+    for ( size_t i = 0; i < parse_table<E>::C; ++i ) {
+      auto string = parse_table_v<E>.string( i );
+      auto length = parse_table_v<E>.length( i );
+      auto state = add( 0, boundary, count );
+      for ( size_t j = 0; j < length; ++j ) {
+        state = add( state, classes_[static_cast<unsigned char>( string[j] )], count );
+      } // end of j-loop
+      state = transitions_[state * K + boundary] = static_cast<state_t>( --terminal );
+      outputs_[state] = parse_table_v<E>.index( i );
+      lengths_[state] = length;
+    } // end of i-loop
+
+    // Breadth first, turn missing edges into the edges of the failure state
+    size_t queue[S] { };
+    size_t failures[S] { };
+    size_t head = 0;
+    size_t tail = 0;
+    for ( size_t c = 0; c < K; ++c ) {
+      auto child = transitions_[c];
+      if ( child != 0 ) queue[tail++] = child;
+    } // end of c-loop
+    while ( head < tail ) {
+      auto state = queue[head++];
+      for ( size_t c = 0; c < K; ++c ) {
+        auto & child = transitions_[state * K + c];
+        auto fallback = transitions_[failures[state] * K + c];
+        if ( child != 0 ) {
+          failures[child] = fallback;
+          queue[tail++] = child;
+        }
+        else {
+          child = fallback;
+        }
+      } // end of c-loop
+    }
+
+    // States are stored as offsets of their rows to save a multiplication
+    for ( size_t i = 0; i < S * K; ++i ) {
+      transitions_[i] = static_cast<state_t>( transitions_[i] * K );
+    } // end of i-loop
+    start_ = transitions_[boundary];
+    first_terminal_ = terminal * K;
+  }
+
+  /// State at the beginning of a text, as if a boundary preceded it. States
+  /// are multiples of K.
+  constexpr size_t start( ) const{
+    return start_;
+  }
+
+  constexpr size_t next( size_t state,
+                         char c ) const{
+    return transitions_[state + classes_[static_cast<unsigned char>( c )]];
+  }
+
+  constexpr bool terminal( size_t state ) const{
+    return state >= first_terminal_;
+  }
+
+  /// Index of the enumerator matched by a terminal state
+  constexpr size_t output( size_t state ) const{
+    return outputs_[state / K];
+  }
+
+  constexpr size_t length( size_t state ) const{
+    return lengths_[state / K];
+  }
+};
+
+template<typename E>
+constexpr search_automaton<E> search_automaton_v{};
+
+} // namespace detail
+
+/// Occurrence of a name or alias of an enumerator in a text
+template<typename E>
+struct name_match {
+  size_t offset;
+  E value;
+};
+
+/// Finds whole word occurrences of the names and aliases of E in a text
+/// given in chunks of any size, carrying partial matches across chunks.
+/// Words consist of ASCII letters, digits and underscores.
+template<typename E>
+class name_scanner {
+  size_t state_;
+  size_t offset_ { };
+
+  template<typename F>
+  void step( char c,
+             F & f ){
+    auto const & automaton = detail::search_automaton_v<E>;
+    state_ = automaton.next( state_, c );
+    if ( automaton.terminal( state_ ) ) {
+      f( name_match<E> { offset_ - automaton.length( state_ ), static_cast<E>( automaton.output( state_ ) ) } );
+    }
+  }
+
+public:
+  name_scanner( ) :
+          state_( detail::search_automaton_v<E>.start( ) ){
+  }
+
+  /// Calls f( name_match<E> ) for every match, with offsets counted from the
+  /// first chunk. A match is reported with the character following it, so
+  /// one at the end of a chunk is reported by the next feed or by finish.
+  template<typename F>
+  void feed( char const * chunk,
+             size_t length,
+             F && f ){
+    for ( size_t i = 0; i < length; ++i, ++offset_ ) {
+      step( chunk[i], f );
+    } // end of i-loop
+  }
+
+  /// Reports a match ending the text and resets the scanner
+  template<typename F>
+  void finish( F && f ){
+    step( ' ', f );
+    state_ = detail::search_automaton_v<E>.start( );
+    offset_ = 0;
+  }
+};
+
+template<typename E>
+std::vector<name_match<E>> find_all( char const * text,
+                                     size_t length ){
+  std::vector<name_match<E>> matches;
+  auto collect = [&]( name_match<E> const & match ){
+    matches.push_back( match );
+  };
+  name_scanner<E> scanner;
+  scanner.feed( text, length, collect );
+  scanner.finish( collect );
+  return matches;
+}
+
+template<typename E>
+std::vector<name_match<E>> find_all( char const * text ){
+  return find_all<E>( text, detail::string_length( text ) );
+}
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_SEARCH_HPP
@@ -0,0 +1,137 @@
+#ifndef NAMED_ENUM_SUBSET_HPP
+#define NAMED_ENUM_SUBSET_HPP
+
+#include "named_enum.hpp"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace named_enum {
+namespace detail {
+
+/// Membership bitmap and compact indices of the enumerators Values of E
+template<typename E, E... Values>
+class subset_table {
+  static constexpr size_t K=sizeof...( Values );
+  static constexpr size_t W=( size<E>() + 63 ) / 64;
+
+  using index_t=small_index_t<K>;
+
+  std::uint64_t bits_[W] { };
+  index_t indices_[size<E>()] { };
+
+public:
+  constexpr subset_table( ){
+    E const values[] = { Values... };
+    for ( size_t i = 0; i < K; ++i ) {
+      auto index = static_cast<size_t>( values[i] );
+      if ( index >= size<E>() ) throw std::out_of_range( "Value is not an enumerator" );
+      if ( bits_[index / 64] & ( std::uint64_t { 1 } << index % 64 ) ) throw std::logic_error( "Duplicate subset value" );
+      bits_[index / 64] |= std::uint64_t { 1 } << index % 64;
+      indices_[index] = static_cast<index_t>( i );
+    } // end of i-loop
+  }
+
+  constexpr bool contains( size_t index ) const{
+    return index < size<E>() && ( bits_[index / 64] >> index % 64 & 1 ) != 0;
+  }
+
+  constexpr size_t index( size_t index ) const{
+    return indices_[index];
+  }
+};
+
+template<typename E, E... Values>
+constexpr subset_table<E, Values...> subset_table_v{};
+
+} // namespace detail
+
+/// Subset of the enumerators of E in the given order, with compact indices
+/// 0 to size() - 1, so that tables over a few enumerators of a large
+/// enumeration need a few slots only
+template<typename E, E... Values>
+struct subset {
+  static_assert( sizeof...( Values ) != 0, "At least one enumerator is required" );
+
+  static constexpr size_t size( ){
+    return sizeof...( Values );
+  }
+
+  /// A bitmap lookup
+  static constexpr bool contains( E const & e ){
+    return detail::subset_table_v<E, Values...>.contains( detail::unsigned_index( e ) );
+  }
+
+  /// Compact index of a member of the subset
+  static constexpr size_t index( E const & e ){
+    return detail::subset_table_v<E, Values...>.index( static_cast<size_t>( e ) );
+  }
+
+  static constexpr E value( size_t index ){
+    E const values[] = { Values... };
+    return values[index];
+  }
+
+  static constexpr std::array<string_t, sizeof...( Values )> names( ){
+    return std::array<string_t, sizeof...( Values )> { { name( Values )... } };
+  }
+};
+
+/// Array with one T per enumerator of a subset
+template<typename Subset, typename T>
+class subset_array;
+
+template<typename E, E... Values, typename T>
+class subset_array<subset<E, Values...>, T> {
+public:
+  using subset_t=subset<E, Values...>;
+
+private:
+  std::array<T, subset_t::size( )> values_ { };
+
+public:
+  /// e must be a member of the subset
+  T & operator[]( E const & e ){
+    return values_[subset_t::index( e )];
+  }
+
+  constexpr T const & operator[]( E const & e ) const{
+    return values_[subset_t::index( e )];
+  }
+
+  /// Throws std::out_of_range if e is not a member of the subset
+  T & at( E const & e ){
+    if ( !subset_t::contains( e ) ) throw std::out_of_range( "Enumerator is not in the subset" );
+    return values_[subset_t::index( e )];
+  }
+
+  T const & at( E const & e ) const{
+    if ( !subset_t::contains( e ) ) throw std::out_of_range( "Enumerator is not in the subset" );
+    return values_[subset_t::index( e )];
+  }
+
+  static constexpr size_t size( ){
+    return subset_t::size( );
+  }
+
+  T * begin( ){
+    return values_.data( );
+  }
+
+  T * end( ){
+    return values_.data( ) + values_.size( );
+  }
+
+  T const * begin( ) const{
+    return values_.data( );
+  }
+
+  T const * end( ) const{
+    return values_.data( ) + values_.size( );
+  }
+};
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_SUBSET_HPP
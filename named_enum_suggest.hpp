@@ -0,0 +1,191 @@
+#ifndef NAMED_ENUM_SUGGEST_HPP
+#define NAMED_ENUM_SUGGEST_HPP
+
+#include "named_enum.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace named_enum {
+namespace detail {
+
+template<typename E> constexpr
+size_t max_name_length( ){
+  auto result = size_t { };
+  for ( size_t i = 0; i < size<E>(); ++i ) {
+    auto length = string_length( names<E>()[i] );
+    if ( length > result ) result = length;
+  } // end of i-loop
+  return result;
+}
+
+/// Enumerator indices grouped by name length, so that names which cannot be
+/// within a given edit distance are skipped without looking at them
+template<typename E>
+class length_buckets {
+  static constexpr size_t L=max_name_length<E>( ) + 1;
+
+  size_t starts_[L + 1] { };
+  size_t indices_[size<E>()] { };
+
+public:
+  constexpr length_buckets( ){
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      ++starts_[string_length( names<E>()[i] ) + 1];
+    } // end of i-loop
+    for ( size_t l = 1; l <= L; ++l ) {
+      starts_[l] += starts_[l - 1];
+    } // end of l-loop
+    size_t next[L] { };
+    for ( size_t i = 0; i < size<E>(); ++i ) {
+      auto length = string_length( names<E>()[i] );
+      indices_[starts_[length] + next[length]++] = i;
+    } // end of i-loop
+  }
+
+  static constexpr size_t max_length( ){
+    return L - 1;
+  }
+
+  /// Indices of names of the given length are [begin( length ), end( length ))
+  constexpr size_t const * begin( size_t length ) const{
+    return &indices_[starts_[length]];
+  }
+
+  constexpr size_t const * end( size_t length ) const{
+    return &indices_[0] + starts_[length + 1];
+  }
+};
+
+template<typename E>
+constexpr length_buckets<E> length_buckets_v{};
+
+/// Levenshtein distances from one pattern of up to 64 characters computed
+/// one column per text character with bit vectors, after G. Myers and in
+/// the formulation of H. Hyyrö for whole strings
+class myers_pattern {
+  std::uint64_t peq_[256] { };
+  std::uint64_t last_;
+  size_t length_;
+
+public:
+  myers_pattern( char const * pattern,
+                 size_t length ) :
+          last_( length != 0 ? std::uint64_t { 1 } << ( length - 1 ) : 0 ),
+          length_( length ){
+    for ( size_t i = 0; i < length; ++i ) {
+      peq_[static_cast<unsigned char>( pattern[i] )] |= std::uint64_t { 1 } << i;
+    } // end of i-loop
+  }
+
+  size_t distance( char const * text,
+                   size_t length ) const{
+    if ( length_ == 0 ) return length;
+    auto pv = ~std::uint64_t { };
+    auto mv = std::uint64_t { };
+    auto score = length_;
+    for ( size_t j = 0; j < length; ++j ) {
+      auto eq = peq_[static_cast<unsigned char>( text[j] )];
+      auto xv = eq | mv;
+      auto xh = ( ( ( eq & pv ) + pv ) ^ pv ) | eq;
+      auto ph = mv | ~( xh | pv );
+      auto mh = pv & xh;
+      if ( ph & last_ ) ++score;
+      else if ( mh & last_ ) --score;
+      ph = ( ph << 1 ) | 1;
+      mh <<= 1;
+      pv = mh | ~( xv | ph );
+      mv = ph & xv;
+    } // end of j-loop
+    return score;
+  }
+};
+
+/// Levenshtein distance by dynamic programming over one row, for patterns
+/// too long for myers_pattern
+inline size_t edit_distance( char const * pattern,
+                             size_t pattern_length,
+                             char const * text,
+                             size_t text_length ){
+  std::vector<size_t> row( pattern_length + 1 );
+  for ( size_t i = 0; i <= pattern_length; ++i ) {
+    row[i] = i;
+  } // end of i-loop
+  for ( size_t j = 0; j < text_length; ++j ) {
+    auto diagonal = row[0];
+    row[0] = j + 1;
+    for ( size_t i = 1; i <= pattern_length; ++i ) {
+      auto above = row[i];
+      auto substitution = diagonal + ( pattern[i - 1] != text[j] ? 1 : 0 );
+      auto insertion = row[i - 1] + 1;
+      auto deletion = above + 1;
+      row[i] = substitution < insertion ? ( substitution < deletion ? substitution : deletion ) :
+               ( insertion < deletion ? insertion : deletion );
+      diagonal = above;
+    } // end of i-loop
+  } // end of j-loop
+  return row[pattern_length];
+}
+
+} // namespace detail
+
+/// Up to k enumerators whose names are nearest to the input by Levenshtein
+/// distance, nearest first and in enumerator order for equal distances,
+/// e.g. for "did you mean" messages after a failed parse
+template<typename E>
+std::vector<E> nearest_names( char const * input,
+                              size_t length,
+                              size_t k ){
+  using candidate=std::pair<size_t, size_t>; // distance and index
+  std::vector<candidate> best;
+  if ( k == 0 ) return { };
+  best.reserve( k + 1 );
+
+  auto const & buckets = detail::length_buckets_v<E>;
+  detail::myers_pattern const pattern( input, length <= 64 ? length : 0 );
+  auto visit = [&]( size_t bucket ){
+    for ( auto i = buckets.begin( bucket ); i != buckets.end( bucket ); ++i ) {
+      auto name = names<E>()[*i];
+      auto distance = length <= 64 ? pattern.distance( name, bucket ) :
+                      detail::edit_distance( input, length, name, bucket );
+      auto value = candidate { distance, *i };
+      if ( best.size( ) == k && !( value < best.back( ) ) ) continue;
+      auto position = best.end( );
+      while ( position != best.begin( ) && value < *( position - 1 ) ) --position;
+      best.insert( position, value );
+      if ( best.size( ) > k ) best.pop_back( );
+    }
+  };
+
+  // The distance is at least the difference in length, so buckets further
+  // from the input length than the k-th best distance cannot contribute
+  for ( size_t difference = 0; ; ++difference ) {
+    if ( best.size( ) == k && difference > best.back( ).first ) break;
+    auto shorter = difference <= length ? length - difference : buckets.max_length( ) + 1;
+    auto longer = length + difference;
+    if ( shorter > buckets.max_length( ) && longer > buckets.max_length( ) ) {
+      if ( difference > length ) break;
+      continue;
+    }
+    if ( shorter <= buckets.max_length( ) ) visit( shorter );
+    if ( difference != 0 && longer <= buckets.max_length( ) ) visit( longer );
+  } // end of difference-loop
+
+  std::vector<E> result;
+  result.reserve( best.size( ) );
+  for ( auto const & c : best ) {
+    result.push_back( static_cast<E>( c.second ) );
+  }
+  return result;
+}
+
+template<typename E>
+std::vector<E> nearest_names( char const * input,
+                              size_t k ){
+  return nearest_names<E>( input, detail::string_length( input ), k );
+}
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_SUGGEST_HPP
@@ -0,0 +1,64 @@
+#ifndef NAMED_ENUM_TABLE_HPP
+#define NAMED_ENUM_TABLE_HPP
+
+#include "named_enum.hpp"
+
+#include <array>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+namespace named_enum {
+namespace detail {
+
+template<typename T, size_t N, size_t... I>
+constexpr std::array<T, N> to_array( T const (&values)[N],
+                                     std::index_sequence<I...> ){
+  return std::array<T, N>{ { values[I]... } };
+}
+
+constexpr bool all_equal( size_t expected,
+                          std::initializer_list<size_t> values ){
+  for ( auto value : values ) {
+    if ( value != expected ) return false;
+  }
+  return true;
+}
+
+} // namespace detail
+
+/// Compile-time columns of attributes of the enumerators of E, one column
+/// per type in Ts. Each column is a contiguous array indexed like names<E>(),
+/// so a lookup is a single load and loops over a column vectorize.
+template<typename E, typename... Ts>
+class enum_table {
+  std::tuple<std::array<Ts, size<E>()>...> columns_;
+
+public:
+  constexpr explicit enum_table( std::array<Ts, size<E>()> const & ... columns ) :
+          columns_( columns... ){
+  }
+
+  template<size_t I>
+  constexpr auto const & column( ) const{
+    return std::get<I>( columns_ );
+  }
+
+  template<size_t I>
+  constexpr auto const & get( E const & e ) const{
+    return std::get<I>( columns_ )[static_cast<size_t>( e )];
+  }
+};
+
+/// Creates an enum_table from one braced list per column, where a list
+/// whose length differs from size<E>() is a compile error
+template<typename E, typename... Ts, size_t... Ns>
+constexpr enum_table<E, Ts...> make_enum_table( Ts const (&... columns)[Ns] ){
+  static_assert( detail::all_equal( size<E>(), { Ns... } ),
+                 "Every column needs one entry per enumerator" );
+  return enum_table<E, Ts...>( detail::to_array( columns, std::make_index_sequence<Ns>() )... );
+}
+
+} // namespace named_enum
+
+#endif // NAMED_ENUM_TABLE_HPP
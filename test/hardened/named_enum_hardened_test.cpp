@@ -0,0 +1,49 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../../named_enum.hpp"
+
+#include "../catch.hpp"
+
+#include <string>
+
+#ifndef NAMED_ENUM_HARDENED_NAME
+#error "The hardened test runner must be compiled with NAMED_ENUM_HARDENED_NAME"
+#endif
+
+MAKE_NAMED_ENUM_CLASS( Hardened, first, second, third );
+MAKE_NAMED_ENUM_CLASS_WITH_TYPE( HardenedSigned, std::int8_t, low, high );
+
+TEST_CASE( "Hardened name of enumerators" ){
+  CHECK( std::string( named_enum::name( Hardened::first ) ) == "first" );
+  CHECK( std::string( named_enum::name( Hardened::third ) ) == "third" );
+  static_assert( named_enum::name( Hardened::second )[0] == 's', "Incorrect name" );
+}
+
+TEST_CASE( "Hardened name of invalid values" ){
+  auto past_end = static_cast<Hardened>( named_enum::size<Hardened>() );
+  CHECK( std::string( named_enum::name( past_end ) ) == NAMED_ENUM_INVALID_NAME );
+  CHECK( std::string( named_enum::name( static_cast<Hardened>( 1000 ) ) ) == NAMED_ENUM_INVALID_NAME );
+
+  auto signed_past_end = static_cast<HardenedSigned>( named_enum::size<HardenedSigned>() );
+  CHECK( std::string( named_enum::name( signed_past_end ) ) == NAMED_ENUM_INVALID_NAME );
+  CHECK( std::string( named_enum::name( static_cast<HardenedSigned>( -1 ) ) ) == NAMED_ENUM_INVALID_NAME );
+}
@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_atomic.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Connection, idle, connecting, open, closed );
+MAKE_NAMED_ENUM_CLASS( Switch, on, off );
+MAKE_NAMED_ENUM_TRANSITIONS( Connection, idle -> connecting, connecting -> open,
+                             connecting -> closed, open -> closed, closed -> idle );
+
+//TEST_CASE("Unknown transitions fail")
+//MAKE_NAMED_ENUM_TRANSITIONS( Connection, idle -> opened ); // <-- error: static assertion failed: Transitions must name existing enumerators
+//connection.transition<Connection::idle, Connection::open>( ); // <-- error: static assertion failed: Transition is not allowed
+
+namespace {
+
+std::string trace;
+
+void record( char const * from,
+             char const * to ){
+  trace += std::string( from ) + "->" + to + " ";
+}
+
+} // namespace
+
+TEST_CASE( "Transitions are declared by name" ){
+  static_assert( named_enum::transition_allowed( Connection::idle, Connection::connecting ), "Allowed" );
+  static_assert( named_enum::transition_allowed( Connection::open, Connection::closed ), "Allowed" );
+  static_assert( !named_enum::transition_allowed( Connection::idle, Connection::open ), "Not allowed" );
+  static_assert( !named_enum::transition_allowed( Connection::closed, Connection::open ), "Not allowed" );
+  static_assert( !named_enum::transition_allowed( Switch::on, Switch::off ), "No transitions" );
+}
+
+TEST_CASE( "Atomic enums follow the allowed transitions" ){
+  named_enum::atomic_enum<Connection> connection( Connection::idle );
+  CHECK( connection.load( ) == Connection::idle );
+
+  CHECK( ( connection.transition<Connection::idle, Connection::connecting>( ) ) );
+  CHECK_FALSE( ( connection.transition<Connection::idle, Connection::connecting>( ) ) );
+  CHECK( connection.load( ) == Connection::connecting );
+
+  auto expected = Connection::connecting;
+  CHECK_FALSE( connection.try_transition( expected, Connection::idle ) );
+  CHECK( connection.load( ) == Connection::connecting );
+  CHECK( connection.try_transition( expected, Connection::open ) );
+  CHECK( connection.load( ) == Connection::open );
+
+  expected = Connection::connecting;
+  CHECK_FALSE( connection.try_transition( expected, Connection::closed ) );
+  CHECK( expected == Connection::open );
+
+  connection.reset( Connection::idle );
+  CHECK( connection.load( ) == Connection::idle );
+}
+
+TEST_CASE( "Disallowed transitions report the current value" ){
+  named_enum::atomic_enum<Connection> connection( Connection::closed );
+
+  // open -> idle is not declared, and the value is not open either
+  auto expected = Connection::open;
+  CHECK_FALSE( connection.try_transition( expected, Connection::idle ) );
+  CHECK( expected == Connection::closed );
+  CHECK( connection.load( ) == Connection::closed );
+
+  // A retry loop ends once the current value has no edge to the target
+  auto attempts = 0;
+  expected = Connection::idle;
+  while ( !connection.try_transition( expected, Connection::open ) ) {
+    ++attempts;
+    if ( !named_enum::transition_allowed( expected, Connection::open ) ) break;
+  }
+  CHECK( attempts == 1 );
+  CHECK( expected == Connection::closed );
+}
+
+TEST_CASE( "Atomic enums trace transitions by name" ){
+  named_enum::atomic_enum<Connection>::set_tracer( record );
+  named_enum::atomic_enum<Connection> connection( Connection::idle );
+  connection.transition<Connection::idle, Connection::connecting>( );
+  connection.transition<Connection::connecting, Connection::closed>( );
+  named_enum::atomic_enum<Connection>::set_tracer( nullptr );
+  connection.transition<Connection::closed, Connection::idle>( );
+
+#ifndef NDEBUG
+  CHECK( trace == "idle->connecting connecting->closed " );
+#else
+  CHECK( trace.empty( ) );
+#endif
+}
+
+TEST_CASE( "Exactly one thread wins a transition" ){
+  named_enum::atomic_enum<Connection> connection( Connection::connecting );
+  std::atomic<int> winners { };
+  auto threads = std::vector<std::thread> { };
+  for ( size_t t = 0; t < 4; ++t ) {
+    threads.emplace_back( [&](){
+      if ( connection.transition<Connection::connecting, Connection::open>( ) ) ++winners;
+    } );
+  } // end of t-loop
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+  CHECK( winners == 1 );
+}
@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_column.hpp"
+
+#include "catch.hpp"
+
+#include <sstream>
+#include <string>
+
+MAKE_NAMED_ENUM_CLASS( Weather, sunny, cloudy, rainy, snowy, foggy );
+MAKE_NAMED_ENUM_CLASS( WeatherV2, sunny, windy, cloudy, rainy, snowy, foggy );
+
+namespace {
+
+std::string write_column( size_t count ){
+  auto stream = std::ostringstream { };
+  named_enum::column_writer<Weather> writer( stream );
+  for ( size_t i = 0; i < count; ++i ) {
+    writer.append( static_cast<Weather>( i % 5 ) );
+  } // end of i-loop
+  writer.finish( );
+  return stream.str( );
+}
+
+} // namespace
+
+TEST_CASE( "Columns are read back in place" ){
+  for ( auto count : { 0, 1, 21, 22, 1000 } ) {
+    auto data = write_column( count );
+    auto column = named_enum::column_view<Weather>( data.data( ), data.size( ) );
+
+    REQUIRE( column.size( ) == count );
+    REQUIRE( column.compatible( ) );
+    for ( size_t i = 0; i < column.size( ); ++i ) {
+      CHECK( column[i] == static_cast<Weather>( i % 5 ) );
+    } // end of i-loop
+  }
+}
+
+TEST_CASE( "Columns pack codes and embed names" ){
+  auto data = write_column( 1000 );
+  // 32 bytes of names and 3 bits per code, i.e. 21 codes per word
+  CHECK( data.size( ) == 32 + 32 + 48 * 8 );
+
+  auto column = named_enum::column_view<WeatherV2>( data.data( ), data.size( ) );
+  CHECK_FALSE( column.compatible( ) );
+  CHECK( column.fingerprint( ) == named_enum::fingerprint<Weather>( ) );
+  REQUIRE( column.names( ).size( ) == 5 );
+  CHECK( std::string( column.name( 1 ) ) == "cloudy" );
+  CHECK( std::string( column.name( 4 ) ) == "foggy" );
+  CHECK( named_enum::from_string<WeatherV2>( column.name( 3 ) ) == WeatherV2::snowy );
+}
+
+TEST_CASE( "Malformed columns are rejected" ){
+  auto data = write_column( 100 );
+  using view = named_enum::column_view<Weather>;
+
+  CHECK_THROWS_AS( view( data.data( ), 16 ), std::invalid_argument );
+  CHECK_THROWS_AS( view( data.data( ), data.size( ) - 8 ), std::invalid_argument );
+
+  auto corrupt = data;
+  corrupt[0] = 'X';
+  CHECK_THROWS_AS( view( corrupt.data( ), corrupt.size( ) ), std::invalid_argument );
+  corrupt = data;
+  corrupt[24] = 6;
+  CHECK_THROWS_AS( view( corrupt.data( ), corrupt.size( ) ), std::invalid_argument );
+  corrupt = data;
+  for ( size_t i = 16; i < 24; ++i ) {
+    corrupt[i] = static_cast<char>( 0xff );
+  }
+  CHECK_THROWS_AS( view( corrupt.data( ), corrupt.size( ) ), std::invalid_argument );
+}
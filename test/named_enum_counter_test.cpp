@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_counter.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Request, get, put, post, remove );
+
+TEST_CASE( "Counters count per enumerator" ){
+  static named_enum::enum_counter<Request, 4> counter;
+  static_assert( sizeof( counter ) == 4 * 64, "Shards are not padded to cache lines" );
+
+  counter.increment( Request::get );
+  counter.increment( Request::get );
+  counter.increment( Request::post, 5 );
+  CHECK( counter[Request::get] == 2 );
+  CHECK( counter[Request::put] == 0 );
+  CHECK( counter[Request::post] == 5 );
+
+  auto exported = std::string { };
+  counter.for_each( [&]( char const * name, std::uint64_t count ){
+    exported += std::string( name ) + "=" + std::to_string( count ) + " ";
+  } );
+  CHECK( exported == "get=2 put=0 post=5 remove=0 " );
+
+  counter.reset( );
+  CHECK( counter.snapshot( ) == ( named_enum::enum_counter<Request, 4>::snapshot_t { } ) );
+}
+
+TEST_CASE( "Counters merge the shards of all threads" ){
+  static named_enum::enum_counter<Request, 3> counter;
+  auto threads = std::vector<std::thread> { };
+  for ( size_t t = 0; t < 8; ++t ) {
+    threads.emplace_back( [](){
+      for ( size_t i = 0; i < 10000; ++i ) {
+        counter.increment( static_cast<Request>( i % 4 ) );
+      } // end of i-loop
+    } );
+  } // end of t-loop
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+
+  auto counts = counter.snapshot( );
+  for ( auto count : counts ) {
+    CHECK( count == 20000 );
+  }
+}
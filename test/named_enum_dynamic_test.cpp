@@ -0,0 +1,138 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_dynamic.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "Dynamic enums are registered and parsed at runtime" ){
+  named_enum::dynamic_enum categories;
+  CHECK( categories.size( ) == 0 );
+  CHECK( std::string( categories.name( 0 ) ) == NAMED_ENUM_INVALID_NAME );
+
+  CHECK( categories.add( "audio" ) == 0 );
+  categories.add( { "video", "input", "audio" } );
+  CHECK( categories.add( "input" ) == 2 );
+  CHECK( categories.size( ) == 3 );
+
+  auto names = categories.names( );
+  REQUIRE( names.size( ) == 3 );
+  CHECK( std::string( names[1] ) == "video" );
+  CHECK( std::string( categories.name( 2 ) ) == "input" );
+
+  auto value = named_enum::dynamic_enum::value_type { };
+  CHECK( categories.try_from_string( "video", value ) );
+  CHECK( value == 1 );
+  CHECK( categories.try_from_string( "audiox", 5, value ) );
+  CHECK( value == 0 );
+  CHECK_FALSE( categories.try_from_string( "audi", value ) );
+  CHECK_THROWS_AS( categories.from_string( "network" ), std::invalid_argument );
+  CHECK_THROWS_AS( categories.add( "" ), std::invalid_argument );
+}
+
+TEST_CASE( "Dynamic enums are read while names are registered" ){
+  named_enum::dynamic_enum categories;
+  std::vector<std::string> strings;
+  for ( int i = 0; i < 200; ++i ) {
+    strings.push_back( "category_" + std::to_string( i ) );
+  }
+
+  std::thread writer( [&]( ){
+    for ( auto const & string : strings ) {
+      categories.add( string.c_str( ) );
+    }
+  } );
+
+  auto consistent = true;
+  while ( categories.size( ) < strings.size( ) ) {
+    auto names = categories.names( );
+    for ( size_t i = 0; i < names.size( ); ++i ) {
+      consistent = consistent && strings[i] == names[i] && categories.from_string( names[i] ) == i;
+    }
+    std::this_thread::yield( );
+  }
+  writer.join( );
+
+  CHECK( consistent );
+  for ( size_t i = 0; i < strings.size( ); ++i ) {
+    CHECK( categories.from_string( strings[i].c_str( ) ) == i );
+  }
+}
+
+TEST_CASE( "Dynamic enum views outlive later registrations" ){
+  named_enum::dynamic_enum categories;
+  categories.add( { "audio", "video" } );
+  auto names = categories.names( );
+  auto name = categories.name( 1 );
+  for ( int i = 0; i < 100; ++i ) {
+    categories.add( ( "category_" + std::to_string( i ) ).c_str( ) );
+  }
+
+  REQUIRE( names.size( ) == 2 );
+  CHECK( std::string( names[0] ) == "audio" );
+  CHECK( std::string( names[1] ) == "video" );
+  CHECK( name == categories.name( 1 ) );
+  CHECK( categories.names( ).size( ) == 102 );
+}
+
+TEST_CASE( "Failed dynamic enum registrations register nothing" ){
+  named_enum::dynamic_enum categories;
+  categories.add( { "audio", "video" } );
+
+  std::vector<std::string> strings;
+  for ( int i = 0; i < 40; ++i ) {
+    strings.push_back( "category_" + std::to_string( i ) );
+  }
+  std::vector<char const *> batch;
+  for ( auto const & string : strings ) {
+    batch.push_back( string.c_str( ) );
+  }
+  batch.push_back( "" );
+  CHECK_THROWS_AS( categories.add( batch.begin( ), batch.end( ) ), std::invalid_argument );
+  CHECK( categories.size( ) == 2 );
+  CHECK( std::string( categories.name( 2 ) ) == NAMED_ENUM_INVALID_NAME );
+  auto value = named_enum::dynamic_enum::value_type { };
+  CHECK_FALSE( categories.try_from_string( "category_0", value ) );
+
+  batch.pop_back( );
+  categories.add( batch.rbegin( ), batch.rend( ) );
+  REQUIRE( categories.size( ) == 42 );
+  for ( size_t i = 0; i < strings.size( ); ++i ) {
+    CHECK( categories.from_string( strings[i].c_str( ) ) == 41 - i );
+  }
+  CHECK( categories.from_string( "video" ) == 1 );
+}
+
+TEST_CASE( "Dynamic enums register names whose hashes collide" ){
+  static_assert( named_enum::detail::fnv1a_32( "costarring", 10 ) == named_enum::detail::fnv1a_32( "liquid", 6 ),
+                 "Colliding names" );
+  named_enum::dynamic_enum words;
+  CHECK( words.add( "costarring" ) == 0 );
+  CHECK( words.add( "liquid" ) == 1 );
+  CHECK( words.add( "costarring" ) == 0 );
+  CHECK( words.size( ) == 2 );
+  CHECK( words.from_string( "liquid" ) == 1 );
+  CHECK( std::string( words.name( 0 ) ) == "costarring" );
+}
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_fsm.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+
+MAKE_NAMED_ENUM_CLASS( Door, closed, open, locked );
+MAKE_NAMED_ENUM_CLASS( Action, push, pull, lock, unlock );
+
+namespace {
+
+struct journal {
+  std::string text;
+};
+
+void creak( journal & l ){
+  l.text += "creak ";
+}
+
+void click( journal & l ){
+  l.text += "click ";
+}
+
+void bump( journal & l ){
+  l.text += "bump ";
+}
+
+using door_table=named_enum::fsm_table<Door, Action, journal>;
+
+constexpr door_table doors { {
+  { Door::closed, Action::push, Door::open, &creak },
+  { Door::open, Action::pull, Door::closed, &creak },
+  { Door::closed, Action::lock, Door::locked, &click },
+  { Door::locked, Action::unlock, Door::closed, nullptr },
+}, &bump };
+
+} // namespace
+
+//TEST_CASE("Duplicate rules fail")
+//constexpr door_table broken { { { Door::closed, Action::push, Door::open, nullptr },
+//                                { Door::closed, Action::push, Door::locked, nullptr } } }; // <-- error: expression '<throw-expression>' is not a constant expression
+
+TEST_CASE( "State machine tables are built at compile time" ){
+  static_assert( doors.handled( Door::closed, Action::push ), "Rule is missing" );
+  static_assert( !doors.handled( Door::locked, Action::push ), "Rule is unexpected" );
+  static_assert( doors.next( Door::closed, Action::lock ) == Door::locked, "Incorrect state" );
+  static_assert( doors.next( Door::locked, Action::push ) == Door::locked, "Incorrect state" );
+}
+
+TEST_CASE( "State machines step through the table" ){
+  auto door = Door::closed;
+  auto l = journal { };
+
+  doors.step( door, Action::push, l );
+  CHECK( door == Door::open );
+  doors.step( door, Action::lock, l );
+  CHECK( door == Door::open );
+  doors.step( door, Action::pull, l );
+  doors.step( door, Action::lock, l );
+  doors.step( door, Action::unlock, l );
+  CHECK( door == Door::closed );
+  CHECK( l.text == "creak bump creak click " );
+}
+
+TEST_CASE( "State machines trace transitions by name" ){
+  auto door = Door::closed;
+  auto l = journal { };
+  auto trace = std::string { };
+  auto tracer = [&]( char const * from, char const * event, char const * to ){
+    trace += std::string( from ) + " -" + event + "-> " + to + "\n";
+  };
+
+  doors.step( door, Action::lock, l, tracer );
+  doors.step( door, Action::pull, l, tracer );
+  CHECK( trace == "closed -lock-> locked\nlocked -pull-> locked\n" );
+}
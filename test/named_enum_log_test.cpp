@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_log.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Event, connect, send, receive, disconnect );
+MAKE_NAMED_ENUM_CLASS( Level, debug, info, warning, error );
+
+TEST_CASE( "Records are decoded by fingerprint" ){
+  auto decoder = named_enum::log_decoder { };
+  decoder.add<Event>( ).add<Level>( );
+
+  auto record = named_enum::make_record( Event::receive, 42 );
+  CHECK( record.type == named_enum::fingerprint<Event>( ) );
+  CHECK( record.code == 2 );
+  CHECK( record.stamp == 42 );
+  CHECK( std::string( decoder.name( record ) ) == "receive" );
+  CHECK( std::string( decoder.name( named_enum::make_record( Level::warning ) ) ) == "warning" );
+
+  record.code = 4;
+  CHECK( std::string( decoder.name( record ) ) == "<invalid>" );
+  record.type = 0;
+  CHECK_FALSE( decoder.knows( record.type ) );
+  CHECK( std::string( decoder.name( record ) ) == "<invalid>" );
+}
+
+TEST_CASE( "Rings hold records up to their capacity" ){
+  named_enum::log_ring<4> ring;
+  auto record = named_enum::log_record { };
+  CHECK_FALSE( ring.try_pop( record ) );
+
+  for ( size_t i = 0; i < 4; ++i ) {
+    CHECK( named_enum::log_enum( ring, static_cast<Event>( i ), i ) );
+  } // end of i-loop
+  CHECK_FALSE( named_enum::log_enum( ring, Event::send ) );
+
+  REQUIRE( ring.try_pop( record ) );
+  CHECK( record.code == 0 );
+  CHECK( named_enum::log_enum( ring, Event::send, 4 ) );
+
+  auto stamps = std::vector<std::uint64_t> { };
+  CHECK( ring.drain( [&]( named_enum::log_record const & r ){ stamps.push_back( r.stamp ); } ) == 4 );
+  CHECK( stamps == ( std::vector<std::uint64_t> { 1, 2, 3, 4 } ) );
+}
+
+TEST_CASE( "Rings pass records between threads in order" ){
+  static named_enum::log_ring<64> ring;
+  const std::uint64_t count = 10000;
+
+  auto producer = std::thread( [&]( ){
+    for ( std::uint64_t i = 0; i < count; ) {
+      if ( named_enum::log_enum( ring, static_cast<Event>( i % 4 ), i ) ) ++i;
+      else std::this_thread::yield( );
+    } // end of i-loop
+  } );
+
+  auto received = std::uint64_t { };
+  auto ordered = true;
+  while ( received < count ) {
+    auto drained = ring.drain( [&]( named_enum::log_record const & r ){
+      ordered = ordered && r.stamp == received && r.code == received % 4;
+      ++received;
+    } );
+    if ( drained == 0 ) std::this_thread::yield( );
+  }
+  producer.join( );
+
+  CHECK( received == count );
+  CHECK( ordered );
+}
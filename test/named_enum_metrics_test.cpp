@@ -0,0 +1,49 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_metrics.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Light, RED, YELLOW, GREEN );
+
+TEST_CASE( "Metric families are written in the text format" ){
+  static named_enum::enum_counter<Light, 2> counter;
+  counter.increment( Light::RED, 12 );
+  counter.increment( Light::GREEN, 18446744073709551615ull );
+
+  auto buffer = std::vector<char>( named_enum::metric_family_capacity<Light>( "lights_total", "state" ) );
+  auto bytes = named_enum::write_metric_family( buffer.data( ), buffer.size( ), "lights_total", "state", counter );
+
+  CHECK( std::string( buffer.data( ), bytes ) ==
+         "lights_total{state=\"RED\"} 12\n"
+         "lights_total{state=\"YELLOW\"} 0\n"
+         "lights_total{state=\"GREEN\"} 18446744073709551615\n" );
+}
+
+TEST_CASE( "Metric families are not truncated" ){
+  std::uint64_t counts[] = { 1, 2, 3 };
+  char buffer[64];
+  CHECK( named_enum::write_metric_family<Light>( buffer, sizeof( buffer ), "lights_total", "state", counts ) == 0 );
+}
@@ -0,0 +1,115 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_open.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Codec, opus, aac );
+
+TEST_CASE( "Open enums keep unknown names" ){
+  using open_codec = named_enum::open_enum<Codec, 8>;
+
+  auto opus = open_codec::from_string( "opus" );
+  CHECK( opus.known( ) );
+  CHECK( opus.value( ) == Codec::opus );
+  CHECK( opus == open_codec( Codec::opus ) );
+
+  auto flac = open_codec::from_string( "flacx", 4 );
+  CHECK_FALSE( flac.known( ) );
+  CHECK( std::string( name( flac ) ) == "flac" );
+  CHECK( flac == open_codec::from_string( "flac" ) );
+  CHECK( flac != open_codec::from_string( "vorbis" ) );
+  CHECK_THROWS_AS( flac.value( ), std::out_of_range );
+
+  auto codec = Codec { };
+  CHECK_FALSE( flac.try_value( codec ) );
+  CHECK( opus.try_value( codec ) );
+  CHECK( codec == Codec::opus );
+}
+
+TEST_CASE( "Open enums reject unknown names once the intern table is full" ){
+  using open_codec = named_enum::open_enum<Codec, 2>;
+
+  auto a = open_codec::from_string( "a" );
+  auto b = open_codec::from_string( "b" );
+  CHECK( a != b );
+  CHECK( a == open_codec::from_string( "a" ) );
+  CHECK( open_codec::from_string( "aac" ).value( ) == Codec::aac );
+  CHECK_THROWS_AS( open_codec::from_string( "c" ), std::length_error );
+}
+
+TEST_CASE( "Open enums compare unknown names of different lengths" ){
+  using open_codec = named_enum::open_enum<Codec, 4>;
+
+  auto const long_name = std::string( 52, 'x' );
+  auto const with_null = std::string( "a\0zzz", 5 );
+  auto a = open_codec::from_string( "a" );
+  auto longer = open_codec::from_string( long_name.c_str( ) );
+  auto b = open_codec::from_string( "bb" );
+  auto null = open_codec::from_string( with_null.data( ), with_null.size( ) );
+
+  // Every further probe visits all slots, holding both shorter and longer names
+  CHECK_THROWS_AS( open_codec::from_string( std::string( 53, 'x' ).c_str( ) ), std::length_error );
+  CHECK_THROWS_AS( open_codec::from_string( "x" ), std::length_error );
+  CHECK_THROWS_AS( open_codec::from_string( "a\0z", 3 ), std::length_error );
+
+  CHECK( open_codec::from_string( "a" ) == a );
+  CHECK( open_codec::from_string( "bb" ) == b );
+  CHECK( open_codec::from_string( long_name.c_str( ) ) == longer );
+  CHECK( open_codec::from_string( with_null.data( ), with_null.size( ) ) == null );
+  CHECK( std::string( name( longer ) ) == long_name );
+}
+
+TEST_CASE( "Open enums intern names from many threads" ){
+  using open_codec = named_enum::open_enum<Codec, 256>;
+
+  std::vector<std::string> strings;
+  for ( int i = 0; i < 100; ++i ) {
+    strings.push_back( "codec_" + std::to_string( i ) );
+  }
+
+  std::vector<std::vector<open_codec>> results( 4 );
+  std::vector<std::thread> threads;
+  for ( size_t t = 0; t < results.size( ); ++t ) {
+    threads.emplace_back( [&, t]( ){
+      for ( size_t i = 0; i < strings.size( ); ++i ) {
+        auto const & string = strings[( i + t * 25 ) % strings.size( )];
+        results[t].push_back( open_codec::from_string( string.c_str( ) ) );
+      }
+    } );
+  }
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+
+  for ( size_t t = 0; t < results.size( ); ++t ) {
+    for ( size_t i = 0; i < strings.size( ); ++i ) {
+      auto const & value = results[t][i];
+      CHECK( std::string( value.name( ) ) == strings[( i + t * 25 ) % strings.size( )] );
+      CHECK( value == results[0][( i + t * 25 ) % strings.size( )] );
+    }
+  }
+}
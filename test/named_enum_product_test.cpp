@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_product.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+
+MAKE_NAMED_ENUM_CLASS( Region, eu, us, apac );
+MAKE_NAMED_ENUM_CLASS( Tier, free, paid );
+MAKE_NAMED_ENUM_CLASS( Status, active, suspended );
+
+TEST_CASE( "Product keys are dense indices of enumerator tuples" ){
+  using key = named_enum::product_key<Region, Tier, Status>;
+
+  static_assert( key::size( ) == 12, "Incorrect size" );
+  static_assert( key::index( Region::eu, Tier::free, Status::active ) == 0, "Incorrect index" );
+  static_assert( key::index( Region::us, Tier::paid, Status::suspended ) == 7, "Incorrect index" );
+  static_assert( key::index( Region::apac, Tier::paid, Status::suspended ) == 11, "Incorrect index" );
+  static_assert( key::get<0>( 7 ) == Region::us, "Incorrect component" );
+  static_assert( key::get<1>( 7 ) == Tier::paid, "Incorrect component" );
+  static_assert( key::get<2>( 7 ) == Status::suspended, "Incorrect component" );
+
+  for ( size_t i = 0; i < key::size( ); ++i ) {
+    auto components = key::decode( i );
+    CHECK( key::index( std::get<0>( components ), std::get<1>( components ), std::get<2>( components ) ) == i );
+  }
+
+  auto names = key::names( 7 );
+  CHECK( std::string( names[0] ) == "us" );
+  CHECK( std::string( names[1] ) == "paid" );
+  CHECK( std::string( names[2] ) == "suspended" );
+}
+
+TEST_CASE( "Product arrays hold one value per enumerator tuple" ){
+  named_enum::product_array<int, Region, Tier> limits;
+  static_assert( decltype( limits )::size( ) == 6, "Incorrect size" );
+
+  limits( Region::us, Tier::paid ) = 100;
+  limits( Region::eu, Tier::free ) = 10;
+  CHECK( limits[3] == 100 );
+
+  auto total = 0;
+  for ( auto limit : limits ) {
+    total += limit;
+  }
+  CHECK( total == 110 );
+
+  auto const & const_limits = limits;
+  CHECK( const_limits( Region::eu, Tier::free ) == 10 );
+  CHECK( const_limits( Region::apac, Tier::free ) == 0 );
+}
@@ -0,0 +1,77 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_random.hpp"
+
+#include "catch.hpp"
+
+#include <random>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Request, get, put, post, remove );
+
+namespace {
+
+constexpr named_enum::weighted_sampler<Request> request_mix { { 6, 3, 1, 0 } };
+
+} // namespace
+
+//TEST_CASE("Weights of the wrong count fail")
+//constexpr named_enum::weighted_sampler<Request> broken { { 6, 3, 1 } }; // <-- error: static assertion failed: Every enumerator needs one weight
+
+TEST_CASE( "Uniform sampling draws every enumerator" ){
+  named_enum::xorshift64 g { 42 };
+  std::vector<Request> requests( 40000 );
+  named_enum::fill_uniform( requests.data( ), requests.size( ), g );
+
+  size_t counts[4] { };
+  for ( auto request : requests ) {
+    ++counts[static_cast<size_t>( request )];
+  }
+  for ( auto count : counts ) {
+    CHECK( count > 9500 );
+    CHECK( count < 10500 );
+  }
+
+  std::mt19937 mt { 7 };
+  CHECK( static_cast<size_t>( named_enum::uniform_enum<Request>( mt ) ) < 4 );
+}
+
+TEST_CASE( "Weighted sampling follows the weights" ){
+  named_enum::xorshift64 g { 7 };
+  std::vector<Request> requests( 100000 );
+  request_mix.fill( requests.data( ), requests.size( ), g );
+
+  size_t counts[4] { };
+  for ( auto request : requests ) {
+    ++counts[static_cast<size_t>( request )];
+  }
+  CHECK( counts[0] > 59000 );
+  CHECK( counts[0] < 61000 );
+  CHECK( counts[1] > 29000 );
+  CHECK( counts[1] < 31000 );
+  CHECK( counts[2] > 9500 );
+  CHECK( counts[2] < 10500 );
+  CHECK( counts[3] == 0 );
+
+  std::uint32_t zeros[4] { };
+  CHECK_THROWS_AS( named_enum::weighted_sampler<Request> { zeros }, std::invalid_argument );
+}
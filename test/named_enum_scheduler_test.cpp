@@ -0,0 +1,116 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_scheduler.hpp"
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Priority, critical, high, normal, low );
+
+TEST_CASE( "Schedulers pop the highest priority first" ){
+  static named_enum::enum_scheduler<Priority, int, 4> scheduler;
+
+  CHECK( scheduler.try_push( Priority::low, 1 ) );
+  CHECK( scheduler.try_push( Priority::normal, 2 ) );
+  CHECK( scheduler.try_push( Priority::high, 3 ) );
+  CHECK( scheduler.try_push( Priority::normal, 4 ) );
+
+  auto value = 0;
+  auto priority = Priority { };
+  REQUIRE( scheduler.try_pop( value, &priority ) );
+  CHECK( value == 3 );
+  CHECK( priority == Priority::high );
+  REQUIRE( scheduler.try_pop( value ) );
+  CHECK( value == 2 );
+
+  CHECK( scheduler.try_push( Priority::critical, 5 ) );
+  REQUIRE( scheduler.try_pop( value ) );
+  CHECK( value == 5 );
+  REQUIRE( scheduler.try_pop( value ) );
+  CHECK( value == 4 );
+  REQUIRE( scheduler.try_pop( value ) );
+  CHECK( value == 1 );
+  CHECK_FALSE( scheduler.try_pop( value ) );
+}
+
+TEST_CASE( "Schedulers count per class" ){
+  static named_enum::enum_scheduler<Priority, int, 2> scheduler;
+  CHECK( scheduler.try_push( Priority::low, 1 ) );
+  CHECK( scheduler.try_push( Priority::low, 2 ) );
+  CHECK_FALSE( scheduler.try_push( Priority::low, 3 ) );
+  auto value = 0;
+  CHECK( scheduler.try_pop( value ) );
+
+  auto stats = scheduler.stats( Priority::low );
+  CHECK( stats.pushed == 2 );
+  CHECK( stats.popped == 1 );
+  CHECK( stats.rejected == 1 );
+
+  auto names = std::string { };
+  scheduler.for_each_stats( [&]( char const * name, named_enum::scheduler_stats const & s ){
+    names += std::string( name ) + ":" + std::to_string( s.pushed ) + " ";
+  } );
+  CHECK( names == "critical:0 high:0 normal:0 low:2 " );
+}
+
+TEST_CASE( "Schedulers accept many producers" ){
+  static named_enum::enum_scheduler<Priority, size_t, 256> scheduler;
+  const size_t producers = 4;
+  const size_t count = 5000;
+
+  auto threads = std::vector<std::thread> { };
+  for ( size_t p = 0; p < producers; ++p ) {
+    threads.emplace_back( [=](){
+      for ( size_t i = 0; i < count; ) {
+        auto value = p * count + i;
+        if ( scheduler.try_push( static_cast<Priority>( value % 4 ), value ) ) ++i;
+        else std::this_thread::yield( );
+      } // end of i-loop
+    } );
+  } // end of p-loop
+
+  auto seen = std::vector<int>( producers * count );
+  auto popped = size_t { };
+  auto matching = true;
+  while ( popped < producers * count ) {
+    auto value = size_t { };
+    auto priority = Priority { };
+    if ( scheduler.try_pop( value, &priority ) ) {
+      matching = matching && static_cast<size_t>( priority ) == value % 4;
+      ++seen[value];
+      ++popped;
+    }
+    else {
+      std::this_thread::yield( );
+    }
+  }
+  for ( auto & thread : threads ) {
+    thread.join( );
+  }
+
+  CHECK( matching );
+  CHECK( std::count( seen.begin( ), seen.end( ), 1 ) == static_cast<long>( seen.size( ) ) );
+}
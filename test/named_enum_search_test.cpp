@@ -0,0 +1,85 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_search.hpp"
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( ScanLevel, info, warn, warning, error );
+MAKE_NAMED_ENUM_ALIASES( ScanLevel, err = error );
+
+namespace {
+
+std::vector<std::pair<size_t, ScanLevel>> hits( std::vector<named_enum::name_match<ScanLevel>> const & matches ){
+  std::vector<std::pair<size_t, ScanLevel>> result;
+  for ( auto const & match : matches ) {
+    result.emplace_back( match.offset, match.value );
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE( "Names are found as whole words" ){
+  using found = std::vector<std::pair<size_t, ScanLevel>>;
+
+  CHECK( hits( named_enum::find_all<ScanLevel>( "info" ) ) == ( found { { 0, ScanLevel::info } } ) );
+  CHECK( hits( named_enum::find_all<ScanLevel>( "[warn] warning: err, error!" ) ) ==
+         ( found { { 1, ScanLevel::warn }, { 7, ScanLevel::warning }, { 16, ScanLevel::error }, { 21, ScanLevel::error } } ) );
+  CHECK( hits( named_enum::find_all<ScanLevel>( "information warn_x xwarn warn2 errors" ) ).empty( ) );
+  CHECK( hits( named_enum::find_all<ScanLevel>( "info info\tinfo" ) ) ==
+         ( found { { 0, ScanLevel::info }, { 5, ScanLevel::info }, { 10, ScanLevel::info } } ) );
+  CHECK( named_enum::find_all<ScanLevel>( "" ).empty( ) );
+}
+
+TEST_CASE( "Names are found across chunks" ){
+  std::string const text = "x warning; info.error warn";
+  auto const expected = hits( named_enum::find_all<ScanLevel>( text.c_str( ) ) );
+  REQUIRE( expected.size( ) == 4 );
+
+  for ( size_t chunk = 1; chunk <= text.size( ); ++chunk ) {
+    std::vector<named_enum::name_match<ScanLevel>> matches;
+    auto collect = [&]( named_enum::name_match<ScanLevel> const & match ){
+      matches.push_back( match );
+    };
+    named_enum::name_scanner<ScanLevel> scanner;
+    for ( size_t offset = 0; offset < text.size( ); offset += chunk ) {
+      scanner.feed( text.data( ) + offset, std::min( chunk, text.size( ) - offset ), collect );
+    }
+    scanner.finish( collect );
+    CHECK( hits( matches ) == expected );
+  }
+}
+
+MAKE_NAMED_ENUM_CLASS( ScanEvent, EVENT_0_CODE, EVENT_1_CODE, EVENT_2_CODE, EVENT_3_CODE, EVENT_4_CODE, EVENT_5_CODE, EVENT_6_CODE, EVENT_7_CODE, EVENT_8_CODE, EVENT_9_CODE, EVENT_10_CODE, EVENT_11_CODE, EVENT_12_CODE, EVENT_13_CODE, EVENT_14_CODE, EVENT_15_CODE, EVENT_16_CODE, EVENT_17_CODE, EVENT_18_CODE, EVENT_19_CODE, EVENT_20_CODE, EVENT_21_CODE, EVENT_22_CODE, EVENT_23_CODE, EVENT_24_CODE, EVENT_25_CODE, EVENT_26_CODE, EVENT_27_CODE, EVENT_28_CODE, EVENT_29_CODE, EVENT_30_CODE, EVENT_31_CODE, EVENT_32_CODE, EVENT_33_CODE, EVENT_34_CODE, EVENT_35_CODE, EVENT_36_CODE, EVENT_37_CODE, EVENT_38_CODE, EVENT_39_CODE, EVENT_40_CODE, EVENT_41_CODE, EVENT_42_CODE, EVENT_43_CODE, EVENT_44_CODE, EVENT_45_CODE, EVENT_46_CODE, EVENT_47_CODE, EVENT_48_CODE, EVENT_49_CODE, EVENT_50_CODE, EVENT_51_CODE, EVENT_52_CODE, EVENT_53_CODE, EVENT_54_CODE, EVENT_55_CODE, EVENT_56_CODE, EVENT_57_CODE, EVENT_58_CODE, EVENT_59_CODE, EVENT_60_CODE, EVENT_61_CODE, EVENT_62_CODE, EVENT_63_CODE, EVENT_64_CODE, EVENT_65_CODE, EVENT_66_CODE, EVENT_67_CODE, EVENT_68_CODE, EVENT_69_CODE, EVENT_70_CODE, EVENT_71_CODE, EVENT_72_CODE, EVENT_73_CODE, EVENT_74_CODE, EVENT_75_CODE, EVENT_76_CODE, EVENT_77_CODE, EVENT_78_CODE, EVENT_79_CODE, EVENT_80_CODE, EVENT_81_CODE, EVENT_82_CODE, EVENT_83_CODE, EVENT_84_CODE, EVENT_85_CODE, EVENT_86_CODE, EVENT_87_CODE, EVENT_88_CODE, EVENT_89_CODE, EVENT_90_CODE, EVENT_91_CODE, EVENT_92_CODE, EVENT_93_CODE, EVENT_94_CODE, EVENT_95_CODE, EVENT_96_CODE, EVENT_97_CODE, EVENT_98_CODE, EVENT_99_CODE, EVENT_100_CODE, EVENT_101_CODE, EVENT_102_CODE, EVENT_103_CODE, EVENT_104_CODE, EVENT_105_CODE, EVENT_106_CODE, EVENT_107_CODE, EVENT_108_CODE, EVENT_109_CODE, EVENT_110_CODE, EVENT_111_CODE, EVENT_112_CODE, EVENT_113_CODE, EVENT_114_CODE, EVENT_115_CODE, EVENT_116_CODE, EVENT_117_CODE, EVENT_118_CODE, EVENT_119_CODE, EVENT_120_CODE, EVENT_121_CODE, EVENT_122_CODE, EVENT_123_CODE, EVENT_124_CODE, EVENT_125_CODE, EVENT_126_CODE, EVENT_127_CODE, EVENT_128_CODE, EVENT_129_CODE, EVENT_130_CODE, EVENT_131_CODE, EVENT_132_CODE, EVENT_133_CODE, EVENT_134_CODE, EVENT_135_CODE, EVENT_136_CODE, EVENT_137_CODE, EVENT_138_CODE, EVENT_139_CODE, EVENT_140_CODE, EVENT_141_CODE, EVENT_142_CODE, EVENT_143_CODE, EVENT_144_CODE, EVENT_145_CODE, EVENT_146_CODE, EVENT_147_CODE, EVENT_148_CODE, EVENT_149_CODE, EVENT_150_CODE, EVENT_151_CODE, EVENT_152_CODE, EVENT_153_CODE, EVENT_154_CODE, EVENT_155_CODE, EVENT_156_CODE, EVENT_157_CODE, EVENT_158_CODE, EVENT_159_CODE, EVENT_160_CODE, EVENT_161_CODE, EVENT_162_CODE, EVENT_163_CODE, EVENT_164_CODE, EVENT_165_CODE, EVENT_166_CODE, EVENT_167_CODE, EVENT_168_CODE, EVENT_169_CODE, EVENT_170_CODE, EVENT_171_CODE, EVENT_172_CODE, EVENT_173_CODE, EVENT_174_CODE, EVENT_175_CODE, EVENT_176_CODE, EVENT_177_CODE, EVENT_178_CODE, EVENT_179_CODE, EVENT_180_CODE, EVENT_181_CODE, EVENT_182_CODE, EVENT_183_CODE, EVENT_184_CODE, EVENT_185_CODE, EVENT_186_CODE, EVENT_187_CODE, EVENT_188_CODE, EVENT_189_CODE, EVENT_190_CODE, EVENT_191_CODE, EVENT_192_CODE, EVENT_193_CODE, EVENT_194_CODE, EVENT_195_CODE, EVENT_196_CODE, EVENT_197_CODE, EVENT_198_CODE, EVENT_199_CODE, EVENT_200_CODE, EVENT_201_CODE, EVENT_202_CODE, EVENT_203_CODE, EVENT_204_CODE, EVENT_205_CODE, EVENT_206_CODE, EVENT_207_CODE, EVENT_208_CODE, EVENT_209_CODE, EVENT_210_CODE, EVENT_211_CODE, EVENT_212_CODE, EVENT_213_CODE, EVENT_214_CODE, EVENT_215_CODE, EVENT_216_CODE, EVENT_217_CODE, EVENT_218_CODE, EVENT_219_CODE, EVENT_220_CODE, EVENT_221_CODE, EVENT_222_CODE, EVENT_223_CODE, EVENT_224_CODE, EVENT_225_CODE, EVENT_226_CODE, EVENT_227_CODE, EVENT_228_CODE, EVENT_229_CODE, EVENT_230_CODE, EVENT_231_CODE, EVENT_232_CODE, EVENT_233_CODE, EVENT_234_CODE, EVENT_235_CODE, EVENT_236_CODE, EVENT_237_CODE, EVENT_238_CODE, EVENT_239_CODE, EVENT_240_CODE, EVENT_241_CODE, EVENT_242_CODE, EVENT_243_CODE, EVENT_244_CODE, EVENT_245_CODE, EVENT_246_CODE, EVENT_247_CODE, EVENT_248_CODE, EVENT_249_CODE, EVENT_250_CODE, EVENT_251_CODE, EVENT_252_CODE, EVENT_253_CODE, EVENT_254_CODE, EVENT_255_CODE, EVENT_256_CODE, EVENT_257_CODE, EVENT_258_CODE, EVENT_259_CODE, EVENT_260_CODE, EVENT_261_CODE, EVENT_262_CODE, EVENT_263_CODE, EVENT_264_CODE, EVENT_265_CODE, EVENT_266_CODE, EVENT_267_CODE, EVENT_268_CODE, EVENT_269_CODE, EVENT_270_CODE, EVENT_271_CODE, EVENT_272_CODE, EVENT_273_CODE, EVENT_274_CODE, EVENT_275_CODE, EVENT_276_CODE, EVENT_277_CODE, EVENT_278_CODE, EVENT_279_CODE, EVENT_280_CODE, EVENT_281_CODE, EVENT_282_CODE, EVENT_283_CODE, EVENT_284_CODE, EVENT_285_CODE, EVENT_286_CODE, EVENT_287_CODE, EVENT_288_CODE, EVENT_289_CODE, EVENT_290_CODE, EVENT_291_CODE, EVENT_292_CODE, EVENT_293_CODE, EVENT_294_CODE, EVENT_295_CODE, EVENT_296_CODE, EVENT_297_CODE, EVENT_298_CODE, EVENT_299_CODE );
+
+TEST_CASE( "Names of large enums are found" ){
+  auto matches = named_enum::find_all<ScanEvent>( "got EVENT_17_CODE and EVENT_299_CODE, not EVENT_3_CODEX" );
+  REQUIRE( matches.size( ) == 2 );
+  CHECK( matches[0].offset == 4 );
+  CHECK( matches[0].value == ScanEvent::EVENT_17_CODE );
+  CHECK( matches[1].offset == 22 );
+  CHECK( matches[1].value == ScanEvent::EVENT_299_CODE );
+}
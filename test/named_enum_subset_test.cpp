@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_subset.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+
+MAKE_NAMED_ENUM_CLASS( Error, e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, e64, e65, e66, e67, e68, e69 );
+
+using retryable = named_enum::subset<Error, Error::e67, Error::e3, Error::e64>;
+
+//TEST_CASE("Duplicate subset values fail")
+//constexpr auto broken = named_enum::subset<Error, Error::e3, Error::e3>::contains( Error::e3 ); // <-- error: expression '<throw-expression>' is not a constant expression
+
+TEST_CASE( "Subsets have compact indices" ){
+  static_assert( retryable::size( ) == 3, "Incorrect size" );
+  static_assert( retryable::contains( Error::e64 ), "Incorrect membership" );
+  static_assert( !retryable::contains( Error::e0 ), "Incorrect membership" );
+  static_assert( !retryable::contains( Error::e63 ), "Incorrect membership" );
+  static_assert( retryable::index( Error::e67 ) == 0, "Incorrect index" );
+  static_assert( retryable::index( Error::e64 ) == 2, "Incorrect index" );
+  static_assert( retryable::value( 1 ) == Error::e3, "Incorrect value" );
+
+  auto names = retryable::names( );
+  CHECK( std::string( names[0] ) == "e67" );
+  CHECK( std::string( names[1] ) == "e3" );
+  CHECK( std::string( names[2] ) == "e64" );
+
+  CHECK_FALSE( retryable::contains( static_cast<Error>( 70 ) ) );
+  CHECK_FALSE( retryable::contains( static_cast<Error>( -1 ) ) );
+}
+
+TEST_CASE( "Subset arrays have one slot per member" ){
+  named_enum::subset_array<retryable, int> retries;
+  static_assert( sizeof( retries ) == 3 * sizeof( int ), "Incorrect size" );
+
+  retries[Error::e3] = 5;
+  retries.at( Error::e64 ) = 2;
+  CHECK( retries[Error::e64] == 2 );
+  CHECK_THROWS_AS( retries.at( Error::e1 ), std::out_of_range );
+
+  auto total = 0;
+  for ( auto count : retries ) {
+    total += count;
+  }
+  CHECK( total == 7 );
+}
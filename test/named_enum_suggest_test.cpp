@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_suggest.hpp"
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+MAKE_NAMED_ENUM_CLASS( Setting, verbose, quiet, timeout, retries, color, colour, log_level );
+
+TEST_CASE( "Nearest names are ordered by edit distance" ){
+  using settings = std::vector<Setting>;
+
+  CHECK( named_enum::nearest_names<Setting>( "verbsoe", 1 ) == settings { Setting::verbose } );
+  CHECK( named_enum::nearest_names<Setting>( "colr", 2 ) == ( settings { Setting::color, Setting::colour } ) );
+  CHECK( named_enum::nearest_names<Setting>( "timeout", 1 ) == settings { Setting::timeout } );
+  CHECK( named_enum::nearest_names<Setting>( "retriesx", 7, 1 ) == settings { Setting::retries } );
+  CHECK( named_enum::nearest_names<Setting>( "", 1 ) == settings { Setting::quiet } );
+  CHECK( named_enum::nearest_names<Setting>( "quiet", 0 ).empty( ) );
+  CHECK( named_enum::nearest_names<Setting>( "loglevel", 10 ).size( ) == named_enum::size<Setting>( ) );
+  CHECK( named_enum::nearest_names<Setting>( "loglevel", 10 ).front( ) == Setting::log_level );
+
+  auto long_input = std::string( 70, 'x' ) + "log_level";
+  CHECK( named_enum::nearest_names<Setting>( long_input.c_str( ), 1 ) == settings { Setting::log_level } );
+}
+
+MAKE_NAMED_ENUM_CLASS( Option, option_0, option_1, option_2, option_3, option_4, option_5, option_6, option_7, option_8, option_9, option_10, option_11, option_12, option_13, option_14, option_15, option_16, option_17, option_18, option_19, option_20, option_21, option_22, option_23, option_24, option_25, option_26, option_27, option_28, option_29, option_30, option_31, option_32, option_33, option_34, option_35, option_36, option_37, option_38, option_39, option_40, option_41, option_42, option_43, option_44, option_45, option_46, option_47, option_48, option_49, option_50, option_51, option_52, option_53, option_54, option_55, option_56, option_57, option_58, option_59, option_60, option_61, option_62, option_63, option_64, option_65, option_66, option_67, option_68, option_69, option_70, option_71, option_72, option_73, option_74, option_75, option_76, option_77, option_78, option_79, option_80, option_81, option_82, option_83, option_84, option_85, option_86, option_87, option_88, option_89, option_90, option_91, option_92, option_93, option_94, option_95, option_96, option_97, option_98, option_99, option_100, option_101, option_102, option_103, option_104, option_105, option_106, option_107, option_108, option_109, option_110, option_111, option_112, option_113, option_114, option_115, option_116, option_117, option_118, option_119, option_120, option_121, option_122, option_123, option_124, option_125, option_126, option_127, option_128, option_129, option_130, option_131, option_132, option_133, option_134, option_135, option_136, option_137, option_138, option_139, option_140, option_141, option_142, option_143, option_144, option_145, option_146, option_147, option_148, option_149, option_150, option_151, option_152, option_153, option_154, option_155, option_156, option_157, option_158, option_159, option_160, option_161, option_162, option_163, option_164, option_165, option_166, option_167, option_168, option_169, option_170, option_171, option_172, option_173, option_174, option_175, option_176, option_177, option_178, option_179, option_180, option_181, option_182, option_183, option_184, option_185, option_186, option_187, option_188, option_189, option_190, option_191, option_192, option_193, option_194, option_195, option_196, option_197, option_198, option_199, option_200, option_201, option_202, option_203, option_204, option_205, option_206, option_207, option_208, option_209, option_210, option_211, option_212, option_213, option_214, option_215, option_216, option_217, option_218, option_219, option_220, option_221, option_222, option_223, option_224, option_225, option_226, option_227, option_228, option_229, option_230, option_231, option_232, option_233, option_234, option_235, option_236, option_237, option_238, option_239, option_240, option_241, option_242, option_243, option_244, option_245, option_246, option_247, option_248, option_249, option_250, option_251, option_252, option_253, option_254, option_255, option_256, option_257, option_258, option_259, option_260, option_261, option_262, option_263, option_264, option_265, option_266, option_267, option_268, option_269, option_270, option_271, option_272, option_273, option_274, option_275, option_276, option_277, option_278, option_279, option_280, option_281, option_282, option_283, option_284, option_285, option_286, option_287, option_288, option_289, option_290, option_291, option_292, option_293, option_294, option_295, option_296, option_297, option_298, option_299 );
+
+TEST_CASE( "Nearest names agree with the dynamic programming distance" ){
+  char const * inputs[] = { "option_12", "opton_299", "option__7", "OPTION_1", "x", "option_1234567" };
+  for ( auto input : inputs ) {
+    auto length = std::string( input ).size( );
+    auto nearest = named_enum::nearest_names<Option>( input, 5 );
+    REQUIRE( nearest.size( ) == 5 );
+
+    auto best = std::vector<size_t> { };
+    for ( auto name : named_enum::names<Option>( ) ) {
+      best.push_back( named_enum::detail::edit_distance( input, length, name, std::string( name ).size( ) ) );
+    }
+    auto sorted = best;
+    std::sort( sorted.begin( ), sorted.end( ) );
+    for ( size_t i = 0; i < nearest.size( ); ++i ) {
+      CHECK( best[static_cast<size_t>( nearest[i] )] == sorted[i] );
+    }
+  }
+}
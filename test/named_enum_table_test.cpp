@@ -0,0 +1,55 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../named_enum_table.hpp"
+
+#include "catch.hpp"
+
+#include <string>
+
+MAKE_NAMED_ENUM_CLASS( Unit, meter, second, kilogram );
+
+namespace {
+
+constexpr auto units = named_enum::make_enum_table<Unit, char const *, double, int>(
+  { "m", "s", "kg" },
+  { 1.0, 2.5, 4.0 },
+  { 1, 1, 1000 } );
+
+} // namespace
+
+//TEST_CASE("Columns of the wrong length fail")
+//constexpr auto broken = named_enum::make_enum_table<Unit, double>( { 1.0, 2.0 } ); // <-- error: static assertion failed: Every column needs one entry per enumerator
+
+TEST_CASE( "Tables hold one column per attribute" ){
+  static_assert( units.get<1>( Unit::second ) == 2.5, "Incorrect weight" );
+  static_assert( units.get<2>( Unit::kilogram ) == 1000, "Incorrect scale" );
+  static_assert( units.column<1>( ).size( ) == named_enum::size<Unit>( ), "Incorrect column length" );
+  static_assert( units.column<2>( ).size( ) == named_enum::size<Unit>( ), "Incorrect column length" );
+
+  CHECK( std::string( units.get<0>( Unit::kilogram ) ) == "kg" );
+
+  auto sum = 0.0;
+  for ( auto weight : units.column<1>( ) ) {
+    sum += weight;
+  }
+  CHECK( sum == 7.5 );
+}
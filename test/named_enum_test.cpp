@@ -20,10 +20,12 @@
 // CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "../named_enum.hpp"
+#include "shared_enum.hpp"
 
 #include "catch.hpp"
 
 #include <iostream>
+#include <vector>
 
 /// TEST_CASE( "Empty enumerator fails" )
 //MAKE_NAMED_ENUM(Foo1); // <-- error: static assertion failed: No enumerators provided
@@ -98,3 +100,293 @@ TEST_CASE("Enum has many names"){
   CHECK( same(names[1], "green") );
   CHECK( same(names[2], "blue") );
 }
+
+TEST_CASE( "Names ignore surrounding whitespace" ){
+  CHECK( same( named_enum::name( Baz4::C4 ), "C4" ) );
+  CHECK( same( named_enum::name( Baz4::D4 ), "D4" ) );
+  CHECK( same( named_enum::name( Baz4::F4 ), "F4" ) );
+}
+
+//TEST_CASE("Aliases of unknown enumerators fail")
+//MAKE_NAMED_ENUM_ALIASES( Color, grey = gray ); // <-- error: static assertion failed: Aliases must name existing enumerators and must not repeat a spelling
+
+MAKE_NAMED_ENUM_CLASS( Shade, grey, cancelled, black );
+MAKE_NAMED_ENUM_ALIASES( Shade, gray = grey, canceled = cancelled,
+                         GREY=grey );
+
+TEST_CASE( "Enumerators are parsed from names" ){
+  CHECK( named_enum::from_string<Color>( "red" ) == Color::red );
+  CHECK( named_enum::from_string<Color>( "blue" ) == Color::blue );
+  CHECK( named_enum::from_string<Baz4>( "C4" ) == Baz4::C4 );
+  CHECK( named_enum::from_string<Color>( "greenish", 5 ) == Color::green );
+
+  CHECK_THROWS_AS( named_enum::from_string<Color>( "gree" ), std::invalid_argument );
+  CHECK_THROWS_AS( named_enum::from_string<Color>( "Red" ), std::invalid_argument );
+
+  auto color = Color::red;
+  CHECK_FALSE( named_enum::try_from_string( "purple", color ) );
+  CHECK( color == Color::red );
+  CHECK( named_enum::try_from_string( "green", color ) );
+  CHECK( color == Color::green );
+}
+
+TEST_CASE( "Aliases are parsed like names" ){
+  CHECK( named_enum::from_string<Shade>( "grey" ) == Shade::grey );
+  CHECK( named_enum::from_string<Shade>( "gray" ) == Shade::grey );
+  CHECK( named_enum::from_string<Shade>( "GREY" ) == Shade::grey );
+  CHECK( named_enum::from_string<Shade>( "canceled" ) == Shade::cancelled );
+  CHECK( named_enum::from_string<Shade>( "black" ) == Shade::black );
+
+  CHECK( same( named_enum::name( named_enum::from_string<Shade>( "gray" ) ), "grey" ) );
+  CHECK( named_enum::names<Shade>( ).size( ) == 3 );
+}
+
+MAKE_NAMED_ENUM_CLASS( Command, start, stop, status, restart, st );
+
+TEST_CASE( "Names are matched one character at a time" ){
+  auto matcher = named_enum::prefix_matcher<Command> { };
+  static_assert( sizeof( matcher ) <= 3, "Matcher state is not compact" );
+
+  CHECK( matcher.feed( "s", 1 ) == named_enum::match_status::partial );
+  CHECK( matcher.step( 't' ) == named_enum::match_status::match );
+  CHECK( matcher.feed( "ar", 2 ) == named_enum::match_status::partial );
+  CHECK( matcher.step( 't' ) == named_enum::match_status::match );
+  CHECK( matcher.depth( ) == 5 );
+
+  auto command = Command { };
+  REQUIRE( matcher.resolve( command ) );
+  CHECK( command == Command::start );
+
+  CHECK( matcher.step( 's' ) == named_enum::match_status::dead );
+  CHECK_FALSE( matcher.resolve( command ) );
+
+  matcher.reset( );
+  CHECK( matcher.feed( "xyz", 3 ) == named_enum::match_status::dead );
+}
+
+TEST_CASE( "Unique prefixes are resolved" ){
+  CHECK( named_enum::from_prefix<Command>( "sto" ) == Command::stop );
+  CHECK( named_enum::from_prefix<Command>( "re" ) == Command::restart );
+  CHECK( named_enum::from_prefix<Command>( "st" ) == Command::st );
+  CHECK( named_enum::from_prefix<Shade>( "gr" ) == Shade::grey );
+  CHECK( named_enum::from_prefix<Shade>( "cancele" ) == Shade::cancelled );
+
+  auto command = Command { };
+  CHECK_FALSE( named_enum::try_from_prefix( "sta", command ) );
+  CHECK_FALSE( named_enum::try_from_prefix( "", command ) );
+  CHECK_THROWS_AS( named_enum::from_prefix<Command>( "x" ), std::invalid_argument );
+
+  static_assert( named_enum::from_prefix<Command>( "sto" ) == Command::stop, "" );
+}
+
+//TEST_CASE("Unknown names fail at compile time")
+//constexpr Color purple = named_enum::from_string<Color>( "purple" ); // <-- error: expression '<throw-expression>' is not a constant expression
+//constexpr Color yellow = "yellow"_enum; // <-- error: in 'constexpr' expansion of 'named_enum::literals::operator""_enum(((const char*)"yellow"), 6)...'
+
+template<Color C>
+struct color_tag {
+  static constexpr Color value=C;
+};
+
+TEST_CASE( "Names are resolved at compile time" ){
+  using namespace named_enum::literals;
+
+  static_assert( named_enum::from_string<Color>( "green" ) == Color::green, "Incorrect enumerator" );
+  static_assert( named_enum::from_string<Shade>( "gray" ) == Shade::grey, "Incorrect enumerator" );
+  static_assert( color_tag<"blue"_enum>::value == Color::blue, "Incorrect enumerator" );
+
+  static_assert( named_enum::is_named_enum<Color>::value, "Color is a named enum" );
+  static_assert( !named_enum::is_named_enum<int>::value, "int is no named enum" );
+
+  constexpr Baz2 baz = "C2"_enum;
+  CHECK( baz == Baz2::C2 );
+
+  Color color = "red"_enum;
+  CHECK( color == Color::red );
+}
+
+MAKE_NAMED_ENUM_WITH_TYPE( Small, signed char, s0, s1, s2 );
+
+TEST_CASE( "Underlying values are checked" ){
+  static_assert( named_enum::is_valid<Color>( 2 ), "Valid enumerator" );
+  static_assert( !named_enum::is_valid<Color>( 3 ), "Invalid enumerator" );
+  static_assert( !named_enum::is_valid<Small>( -1 ), "Invalid enumerator" );
+  static_assert( named_enum::from_underlying<Small>( 1 ) == s1, "Incorrect enumerator" );
+
+  CHECK( named_enum::from_underlying<Color>( 1 ) == Color::green );
+  CHECK_THROWS_AS( named_enum::from_underlying<Color>( -1 ), std::out_of_range );
+
+  auto color = Color::red;
+  CHECK_FALSE( named_enum::try_from_underlying( 7, color ) );
+  CHECK( named_enum::try_from_underlying( 2, color ) );
+  CHECK( color == Color::blue );
+}
+
+TEST_CASE( "Columns of underlying values are validated" ){
+  auto column = std::vector<signed char>( 1000 );
+  for ( size_t i = 0; i < column.size( ); ++i ) {
+    column[i] = static_cast<signed char>( i % 3 );
+  } // end of i-loop
+
+  CHECK( named_enum::validate<Small>( column.data( ), column.size( ) ) == 1000 );
+  CHECK( named_enum::validate<Small>( column.data( ), 0 ) == 0 );
+
+  column[999] = 3;
+  CHECK( named_enum::validate<Small>( column.data( ), column.size( ) ) == 999 );
+  column[130] = -2;
+  CHECK( named_enum::validate<Small>( column.data( ), column.size( ) ) == 130 );
+  column[5] = 100;
+  CHECK( named_enum::validate<Small>( column.data( ), column.size( ) ) == 5 );
+}
+
+TEST_CASE( "Names of invalid values fall back" ){
+  auto invalid = static_cast<Color>( 3 );
+  auto negative = static_cast<Small>( -1 );
+
+  CHECK( same( named_enum::name_or( Color::green, "none" ), "green" ) );
+  CHECK( same( named_enum::name_or( invalid, "none" ), "none" ) );
+  CHECK( same( named_enum::name_or( negative, "none" ), "none" ) );
+
+  CHECK( same( named_enum::checked_name( Color::blue ), "blue" ) );
+  CHECK( same( named_enum::checked_name( invalid ), "<invalid>" ) );
+  CHECK( same( named_enum::checked_name( static_cast<Color>( 1000 ) ), "<invalid>" ) );
+  CHECK( same( named_enum::checked_name( negative ), "<invalid>" ) );
+
+  static_assert( named_enum::checked_name( Color::red )[0] == 'r', "Incorrect name" );
+}
+
+MAKE_NAMED_ENUM_CLASS( Fruit, apple, pear, plum );
+MAKE_NAMED_ENUM_CLASS( Reordered, apple, plum, pear );
+MAKE_NAMED_ENUM_CLASS( Joined, applepear, plum );
+MAKE_NAMED_ENUM_WITH_TYPE( Typed, short, apple, pear, plum );
+
+TEST_CASE( "Fingerprints depend on names and order" ){
+  static_assert( named_enum::fingerprint<Fruit>( ) == named_enum::fingerprint<Typed>( ), "Same names" );
+  static_assert( named_enum::fingerprint<Fruit>( ) != named_enum::fingerprint<Reordered>( ), "Different order" );
+  static_assert( named_enum::fingerprint<Fruit>( ) != named_enum::fingerprint<Joined>( ), "Different names" );
+  static_assert( named_enum::fingerprint<Fruit>( ) != named_enum::fingerprint<Color>( ), "Different names" );
+
+  // FNV-1a 64 of "apple\0pear\0plum\0"
+  CHECK( named_enum::fingerprint( Fruit::pear ) == 0x39d750959f0bf477ull );
+}
+
+MAKE_NAMED_ENUM_CLASS( Many, m00, m01, m02, m03, m04, m05, m06, m07, m08, m09,
+                             m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                             m20, m21, m22, m23, m24, m25, m26, m27, m28, m29,
+                             m30, m31, m32, m33, m34, m35, m36, m37, m38, m39 );
+
+TEST_CASE( "Name hashes do not depend on the position" ){
+  static_assert( named_enum::name_hash( Fruit::pear ) == named_enum::name_hash( Reordered::pear ), "Same name" );
+  static_assert( named_enum::name_hash( Fruit::pear ) != named_enum::name_hash( Fruit::plum ), "Different names" );
+
+  // FNV-1a 32 of "pear"
+  CHECK( named_enum::name_hash( Fruit::pear ) == 0xd01fc26du );
+}
+
+TEST_CASE( "Enumerators are found by name hash" ){
+  static_assert( named_enum::from_name_hash<Reordered>( named_enum::name_hash( Fruit::plum ) ) == Reordered::plum,
+                 "Incorrect enumerator" );
+
+  for ( size_t i = 0; i < named_enum::size<Many>( ); ++i ) {
+    auto many = static_cast<Many>( i );
+    CHECK( named_enum::from_name_hash<Many>( named_enum::name_hash( many ) ) == many );
+  } // end of i-loop
+
+  auto fruit = Fruit::apple;
+  CHECK_FALSE( named_enum::try_from_name_hash( named_enum::name_hash( Color::red ), fruit ) );
+  CHECK_FALSE( named_enum::try_from_name_hash( 0u, fruit ) );
+  CHECK( fruit == Fruit::apple );
+  CHECK_THROWS_AS( named_enum::from_name_hash<Fruit>( 42u ), std::invalid_argument );
+}
+
+MAKE_NAMED_ENUM_CLASS( StateV1, idle, running, canceled, done );
+MAKE_NAMED_ENUM_WITH_TYPE( StateV2, unsigned char, idle, starting, running, cancelled, failed, done );
+MAKE_NAMED_ENUM_ALIASES( StateV2, canceled = cancelled );
+
+TEST_CASE( "Enumerators are remapped by name" ){
+  static_assert( named_enum::remaps_all<StateV1, StateV2>( ), "All names are known" );
+  static_assert( !named_enum::remaps_all<StateV2, StateV1>( ), "Names are missing" );
+  static_assert( named_enum::remap<StateV2>( StateV1::running ) == running, "Incorrect enumerator" );
+
+  CHECK( named_enum::remap<StateV2>( StateV1::canceled ) == cancelled );
+  CHECK( named_enum::remap<StateV1>( done ) == StateV1::done );
+  CHECK( named_enum::remap_or( starting, StateV1::idle ) == StateV1::idle );
+  CHECK_THROWS_AS( named_enum::remap<StateV1>( failed ), std::invalid_argument );
+
+  auto state = StateV1::idle;
+  CHECK_FALSE( named_enum::try_remap( static_cast<StateV2>( 17 ), state ) );
+  CHECK( state == StateV1::idle );
+}
+
+TEST_CASE( "Code columns are remapped by name" ){
+  auto const codes = std::vector<int> { 0, 1, 2, 3, 3, -1, 4, 1 };
+  auto result = std::vector<unsigned char>( codes.size( ) );
+
+  named_enum::remap_codes<StateV1, StateV2>( codes.data( ), codes.size( ), result.data( ), failed );
+  CHECK( result == ( std::vector<unsigned char> { 0, 2, 3, 5, 5, 4, 4, 2 } ) );
+
+  auto const back = std::vector<unsigned char> { 0, 1, 2, 3, 4, 5, 200 };
+  auto codes_v1 = std::vector<int>( back.size( ) );
+  named_enum::remap_codes<StateV2, StateV1>( back.data( ), back.size( ), codes_v1.data( ), StateV1::idle );
+  CHECK( codes_v1 == ( std::vector<int> { 0, 0, 1, 0, 0, 3, 0 } ) );
+}
+
+TEST_CASE( "Enumerators are found by name pointer" ){
+  auto pointer = named_enum::name( Baz4::D4 );
+  CHECK( named_enum::from_name_pointer<Baz4>( pointer ) == Baz4::D4 );
+  CHECK( named_enum::from_name_pointer<Baz4>( named_enum::names<Baz4>()[0] ) == Baz4::A4 );
+  CHECK( named_enum::from_name_pointer<Baz4>( named_enum::names<Baz4>()[5] ) == Baz4::F4 );
+
+  char const copy[] = "D4";
+  auto e = Baz4::A4;
+  CHECK_FALSE( named_enum::try_from_name_pointer( copy, e ) );
+  CHECK_FALSE( named_enum::try_from_name_pointer( pointer + 1, e ) );
+  CHECK_FALSE( named_enum::try_from_name_pointer( pointer - 1, e ) );
+  CHECK_FALSE( named_enum::is_name_pointer<Baz4>( named_enum::name( Baz3::D3 ) ) );
+  CHECK( e == Baz4::A4 );
+  CHECK_THROWS_AS( named_enum::from_name_pointer<Baz4>( copy ), std::invalid_argument );
+
+  CHECK( named_enum::name_equal<Baz4>( pointer, copy ) );
+  CHECK( named_enum::name_equal<Baz4>( copy, pointer ) );
+  CHECK( named_enum::name_equal<Baz4>( pointer, named_enum::name( Baz4::D4 ) ) );
+  CHECK_FALSE( named_enum::name_equal<Baz4>( pointer, named_enum::name( Baz4::E4 ) ) );
+  CHECK_FALSE( named_enum::name_equal<Baz4>( copy, "D" ) );
+}
+
+TEST_CASE( "Tokens are prefiltered before parsing" ){
+  static_assert( named_enum::might_be_name<Shade>( "grey" ), "Names must pass" );
+  static_assert( named_enum::might_be_name<Shade>( "gray" ), "Aliases must pass" );
+  static_assert( named_enum::might_be_name<Shade>( "canceled" ), "Aliases must pass" );
+  static_assert( !named_enum::might_be_name<Shade>( "" ), "Empty tokens must fail" );
+  static_assert( !named_enum::might_be_name<Shade>( "grey1" ), "Unknown lengths must fail" );
+  static_assert( !named_enum::might_be_name<Shade>( "frey" ), "Unknown first characters must fail" );
+  static_assert( !named_enum::might_be_name<Shade>( "grez" ), "Unknown last characters must fail" );
+#ifndef NAMED_ENUM_BLOOM_FILTER
+  static_assert( named_enum::might_be_name<Shade>( "gkey" ), "Only necessary conditions are checked" );
+#endif
+
+  CHECK_FALSE( named_enum::might_be_name<Shade>( "greyish", 7 ) );
+  CHECK( named_enum::might_be_name<Shade>( "greyish", 4 ) );
+
+  auto shade = Shade::black;
+  CHECK_FALSE( named_enum::try_from_string( "gkey", shade ) );
+  CHECK( shade == Shade::black );
+
+  for ( auto name : named_enum::names<Many>( ) ) {
+    CHECK( named_enum::might_be_name<Many>( name ) );
+  }
+}
+
+TEST_CASE( "Name pointers are shared by all translation units" ){
+  auto pointer = shared_name_from_other_unit( Shared::second );
+  CHECK( pointer == named_enum::name( Shared::second ) );
+  CHECK( named_enum::from_name_pointer<Shared>( pointer ) == Shared::second );
+
+  auto value = Shared::first;
+  CHECK( shared_name_pointer_in_other_unit( named_enum::name( Shared::third ), value ) );
+  CHECK( value == Shared::third );
+
+  CHECK( shared_alias_strings_from_other_unit( ) == named_enum::enum_alias_traits<Shared>::strings( ) );
+  CHECK( named_enum::from_string<Shared>( "one" ) == Shared::first );
+  CHECK( shared_transition_strings_from_other_unit( ) == named_enum::enum_transition_traits<Shared>::strings( ) );
+}
@@ -0,0 +1,46 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2016-2018 Nils Zander, Tino Bog
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "shared_enum.hpp"
+
+char const * shared_name_from_other_unit( Shared value ){
+  // Constant expressions use the names of this translation unit even when
+  // names<Shared>( ) is not inlined
+  static constexpr char const * names[] = { named_enum::names<Shared>()[0],
+                                            named_enum::names<Shared>()[1],
+                                            named_enum::names<Shared>()[2] };
+  return names[static_cast<size_t>( value )];
+}
+
+bool shared_name_pointer_in_other_unit( char const * name,
+                                        Shared & value ){
+  return named_enum::try_from_name_pointer( name, value );
+}
+
+char const * const * shared_alias_strings_from_other_unit( ){
+  static constexpr char const * const * strings = named_enum::enum_alias_traits<Shared>::strings( );
+  return strings;
+}
+
+char const * const * shared_transition_strings_from_other_unit( ){
+  static constexpr char const * const * strings = named_enum::enum_transition_traits<Shared>::strings( );
+  return strings;
+}